@@ -0,0 +1,2313 @@
+
+#include "../../../include/display/lvgl.h"
+
+/***********************************************************************************
+ * FontAwesome5-Solid+Brands+Regular.woff 20 px Font in U+0020 ( ) .. U+007e (~)  range with 4 bpp
+***********************************************************************************/
+
+/*Store the image of the letters (glyph)*/
+static const uint8_t dejavu_20_glyph_bitmap[] = 
+{
+  /*Unicode: U+0020 ( ) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0021 (!) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0022 (") , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0023 (#) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0024 ($) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0025 (%) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0026 (&) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0027 (') , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0028 (() , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0029 ()) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+002a (*) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+002b (+) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+002c (,) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+002d (-) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x11, 0x11, 0x11,  //...... 
+  0xff, 0xff, 0xff,  //@@@@@@ 
+  0x44, 0x44, 0x44,  //++++++ 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+002e (.) , Width: 2 */
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x21,  //.. 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+
+
+  /*Unicode: U+002f (/) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0030 (0) , Width: 11 */
+  0x00, 0x3a, 0xef, 0xd8, 0x10, 0x00,  //...%@@@%... 
+  0x05, 0xfe, 0x87, 0xaf, 0xd1, 0x00,  //.+@@%+%@@.. 
+  0x1e, 0xe1, 0x00, 0x04, 0xfa, 0x00,  //.@@....+@%. 
+  0x6f, 0x50, 0x00, 0x00, 0xaf, 0x10,  //+@+.....%@. 
+  0xbf, 0x00, 0x00, 0x00, 0x5f, 0x60,  //%@......+@+ 
+  0xdd, 0x00, 0x00, 0x00, 0x2f, 0x90,  //@@.......@% 
+  0xfc, 0x00, 0x00, 0x00, 0x0f, 0xa0,  //@@.......@% 
+  0xfb, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.......@% 
+  0xfc, 0x00, 0x00, 0x00, 0x0f, 0xa0,  //@@.......@% 
+  0xdd, 0x00, 0x00, 0x00, 0x2f, 0x90,  //@@.......@% 
+  0xbf, 0x00, 0x00, 0x00, 0x5f, 0x60,  //%@......+@+ 
+  0x6f, 0x50, 0x00, 0x00, 0xaf, 0x20,  //+@+.....%@. 
+  0x1e, 0xe1, 0x00, 0x04, 0xfb, 0x00,  //.@@....+@%. 
+  0x05, 0xfe, 0x87, 0xaf, 0xe2, 0x00,  //.+@@%+%@@.. 
+  0x00, 0x3a, 0xef, 0xd9, 0x10, 0x00,  //...%@@@%... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0031 (1) , Width: 8 */
+  0x00, 0x1a, 0xf0, 0x00,  //...%@... 
+  0x07, 0xff, 0xf0, 0x00,  //.+@@@... 
+  0xdf, 0xac, 0xf0, 0x00,  //@@%@@... 
+  0xc3, 0x0b, 0xf0, 0x00,  //@..%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x00, 0x0b, 0xf0, 0x00,  //...%@... 
+  0x66, 0x6d, 0xf6, 0x66,  //+++@@+++ 
+  0xff, 0xff, 0xff, 0xff,  //@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00,  //........ 
+  0x00, 0x00, 0x00, 0x00,  //........ 
+  0x00, 0x00, 0x00, 0x00,  //........ 
+  0x00, 0x00, 0x00, 0x00,  //........ 
+  0x00, 0x00, 0x00, 0x00,  //........ 
+
+
+  /*Unicode: U+0032 (2) , Width: 11 */
+  0x00, 0x6b, 0xef, 0xea, 0x20, 0x00,  //..+%@@@%... 
+  0x1d, 0xfd, 0x87, 0x8e, 0xf3, 0x00,  //.@@@%+%@@.. 
+  0x1d, 0x50, 0x00, 0x02, 0xfb, 0x00,  //.@+.....@%. 
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x00,  //........@@. 
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x00,  //........@@. 
+  0x00, 0x00, 0x00, 0x01, 0xfb, 0x00,  //........@%. 
+  0x00, 0x00, 0x00, 0x09, 0xf4, 0x00,  //.......%@+. 
+  0x00, 0x00, 0x00, 0x5f, 0xb0, 0x00,  //......+@%.. 
+  0x00, 0x00, 0x04, 0xfd, 0x10, 0x00,  //.....+@@... 
+  0x00, 0x00, 0x3f, 0xe2, 0x00, 0x00,  //.....@@.... 
+  0x00, 0x02, 0xee, 0x20, 0x00, 0x00,  //....@@..... 
+  0x00, 0x1d, 0xf3, 0x00, 0x00, 0x00,  //...@@...... 
+  0x01, 0xdf, 0x40, 0x00, 0x00, 0x00,  //..@@+...... 
+  0x0c, 0xfb, 0x66, 0x66, 0x66, 0x60,  //.@@%+++++++ 
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0,  //.@@@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0033 (3) , Width: 10 */
+  0x01, 0x8c, 0xef, 0xd8, 0x10,  //..%@@@@%.. 
+  0x4f, 0xfb, 0x77, 0xaf, 0xd0,  //+@@%++%@@. 
+  0x5c, 0x20, 0x00, 0x07, 0xf7,  //+@.....+@+ 
+  0x00, 0x00, 0x00, 0x00, 0xfa,  //........@% 
+  0x00, 0x00, 0x00, 0x00, 0xfa,  //........@% 
+  0x00, 0x00, 0x00, 0x05, 0xf6,  //.......+@+ 
+  0x00, 0x01, 0x12, 0x7f, 0xc0,  //......+@@. 
+  0x00, 0x0d, 0xff, 0xfd, 0x10,  //...@@@@@.. 
+  0x00, 0x03, 0x45, 0x8e, 0xe2,  //....++%@@. 
+  0x00, 0x00, 0x00, 0x02, 0xfb,  //........@% 
+  0x00, 0x00, 0x00, 0x00, 0xcf,  //........@@ 
+  0x00, 0x00, 0x00, 0x00, 0xcf,  //........@@ 
+  0x88, 0x00, 0x00, 0x03, 0xfb,  //%%......@% 
+  0x8f, 0xfa, 0x77, 0x9f, 0xe2,  //%@@%++%@@. 
+  0x02, 0x9d, 0xff, 0xd9, 0x10,  //..%@@@@%.. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0034 (4) , Width: 11 */
+  0x00, 0x00, 0x00, 0x1e, 0xb0, 0x00,  //.......@%.. 
+  0x00, 0x00, 0x00, 0xcf, 0xb0, 0x00,  //......@@%.. 
+  0x00, 0x00, 0x07, 0xff, 0xb0, 0x00,  //.....+@@%.. 
+  0x00, 0x00, 0x3f, 0x8f, 0xb0, 0x00,  //.....@%@%.. 
+  0x00, 0x01, 0xec, 0x0f, 0xb0, 0x00,  //....@@.@%.. 
+  0x00, 0x0b, 0xe1, 0x0f, 0xb0, 0x00,  //...%@..@%.. 
+  0x00, 0x6f, 0x50, 0x0f, 0xb0, 0x00,  //..+@+..@%.. 
+  0x02, 0xf9, 0x00, 0x0f, 0xb0, 0x00,  //..@%...@%.. 
+  0x0d, 0xc0, 0x00, 0x0f, 0xb0, 0x00,  //.@@....@%.. 
+  0x9f, 0x41, 0x11, 0x1f, 0xb1, 0x10,  //%@+....@%.. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@ 
+  0x44, 0x44, 0x44, 0x4f, 0xc4, 0x40,  //+++++++@@++ 
+  0x00, 0x00, 0x00, 0x0f, 0xb0, 0x00,  //.......@%.. 
+  0x00, 0x00, 0x00, 0x0f, 0xb0, 0x00,  //.......@%.. 
+  0x00, 0x00, 0x00, 0x0f, 0xb0, 0x00,  //.......@%.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0035 (5) , Width: 11 */
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0x10,  //.@@@@@@@@@. 
+  0x0f, 0xd6, 0x66, 0x66, 0x66, 0x00,  //.@@+++++++. 
+  0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x0f, 0xb0, 0x01, 0x00, 0x00, 0x00,  //.@%........ 
+  0x0f, 0xb7, 0xef, 0xfe, 0x70, 0x00,  //.@%+@@@@+.. 
+  0x0f, 0xfd, 0x75, 0x6c, 0xfb, 0x00,  //.@@@+++@@%. 
+  0x0f, 0xa0, 0x00, 0x00, 0xaf, 0x50,  //.@%.....%@+ 
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x90,  //.........@% 
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //.........@% 
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0x90,  //.........@% 
+  0x1c, 0x30, 0x00, 0x00, 0xbf, 0x30,  //.@......%@. 
+  0x2d, 0xfc, 0x87, 0x8d, 0xf7, 0x00,  //.@@@%+%@@+. 
+  0x00, 0x6b, 0xef, 0xeb, 0x40, 0x00,  //..+%@@@%+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0036 (6) , Width: 11 */
+  0x00, 0x07, 0xdf, 0xfc, 0x81, 0x00,  //...+@@@@%.. 
+  0x01, 0xdf, 0xb7, 0x7b, 0xfe, 0x40,  //..@@%++%@@+ 
+  0x0b, 0xf6, 0x00, 0x00, 0x2c, 0x50,  //.%@+.....@+ 
+  0x3f, 0xa0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x9f, 0x30, 0x00, 0x00, 0x00, 0x00,  //%@......... 
+  0xcf, 0x00, 0x01, 0x00, 0x00, 0x00,  //@@......... 
+  0xec, 0x08, 0xef, 0xfd, 0x60, 0x00,  //@@.%@@@@+.. 
+  0xfb, 0xbe, 0x75, 0x6c, 0xfa, 0x00,  //@%%@+++@@%. 
+  0xff, 0xd1, 0x00, 0x00, 0xaf, 0x40,  //@@@.....%@+ 
+  0xef, 0x50, 0x00, 0x00, 0x2f, 0x90,  //@@+......@% 
+  0xbf, 0x30, 0x00, 0x00, 0x0f, 0xb0,  //%@.......@% 
+  0x6f, 0x60, 0x00, 0x00, 0x2f, 0x90,  //+@+......@% 
+  0x0e, 0xd1, 0x00, 0x00, 0xbf, 0x30,  //.@@.....%@. 
+  0x03, 0xee, 0x96, 0x8d, 0xf7, 0x00,  //..@@%+%@@+. 
+  0x00, 0x19, 0xdf, 0xeb, 0x40, 0x00,  //...%@@@%+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0037 (7) , Width: 10 */
+  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0x66, 0x66, 0x66, 0x67, 0xfd,  //++++++++@@ 
+  0x00, 0x00, 0x00, 0x07, 0xf5,  //.......+@+ 
+  0x00, 0x00, 0x00, 0x0e, 0xd0,  //.......@@. 
+  0x00, 0x00, 0x00, 0x8f, 0x50,  //......%@+. 
+  0x00, 0x00, 0x01, 0xfc, 0x00,  //......@@.. 
+  0x00, 0x00, 0x08, 0xf4, 0x00,  //.....%@+.. 
+  0x00, 0x00, 0x1f, 0xc0, 0x00,  //.....@@... 
+  0x00, 0x00, 0x9f, 0x40, 0x00,  //....%@+... 
+  0x00, 0x02, 0xfb, 0x00, 0x00,  //....@%.... 
+  0x00, 0x0a, 0xf3, 0x00, 0x00,  //...%@..... 
+  0x00, 0x2f, 0xb0, 0x00, 0x00,  //...@%..... 
+  0x00, 0xaf, 0x30, 0x00, 0x00,  //..%@...... 
+  0x03, 0xfa, 0x00, 0x00, 0x00,  //..@%...... 
+  0x0b, 0xf2, 0x00, 0x00, 0x00,  //.%@....... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0038 (8) , Width: 11 */
+  0x00, 0x5b, 0xef, 0xeb, 0x50, 0x00,  //..+%@@@%+.. 
+  0x0a, 0xfd, 0x86, 0x8d, 0xfa, 0x00,  //.%@@%+%@@%. 
+  0x6f, 0x90, 0x00, 0x00, 0x9f, 0x60,  //+@%.....%@+ 
+  0xaf, 0x10, 0x00, 0x00, 0x1f, 0xa0,  //%@.......@% 
+  0xaf, 0x10, 0x00, 0x00, 0x1f, 0xa0,  //%@.......@% 
+  0x5f, 0x80, 0x00, 0x00, 0x8f, 0x50,  //+@%.....%@+ 
+  0x08, 0xfb, 0x53, 0x5b, 0xf8, 0x00,  //.%@%+.+%@%. 
+  0x00, 0x9f, 0xff, 0xff, 0x80, 0x00,  //..%@@@@@%.. 
+  0x1d, 0xe7, 0x20, 0x39, 0xfc, 0x00,  //.@@+...%@@. 
+  0xaf, 0x20, 0x00, 0x00, 0x7f, 0x60,  //%@......+@+ 
+  0xfc, 0x00, 0x00, 0x00, 0x0f, 0xa0,  //@@.......@% 
+  0xec, 0x00, 0x00, 0x00, 0x1f, 0xa0,  //@@.......@% 
+  0xaf, 0x40, 0x00, 0x00, 0x8f, 0x50,  //%@+.....%@+ 
+  0x1d, 0xfa, 0x76, 0x8c, 0xfa, 0x00,  //.@@%++%@@%. 
+  0x00, 0x7c, 0xff, 0xeb, 0x50, 0x00,  //..+@@@@%+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0039 (9) , Width: 11 */
+  0x00, 0x6c, 0xff, 0xc6, 0x00, 0x00,  //..+@@@@+... 
+  0x0a, 0xfb, 0x77, 0xbf, 0xc0, 0x00,  //.%@%++%@@.. 
+  0x7f, 0x70, 0x00, 0x05, 0xf9, 0x00,  //+@+....+@%. 
+  0xde, 0x00, 0x00, 0x00, 0xbf, 0x10,  //@@......%@. 
+  0xfb, 0x00, 0x00, 0x00, 0x8f, 0x60,  //@%......%@+ 
+  0xed, 0x00, 0x00, 0x00, 0x9f, 0x90,  //@@......%@% 
+  0xaf, 0x30, 0x00, 0x01, 0xef, 0xa0,  //%@......@@% 
+  0x2f, 0xf6, 0x22, 0x6e, 0x9f, 0xb0,  //.@@+..+@%@% 
+  0x02, 0xcf, 0xff, 0xf8, 0x1f, 0xa0,  //..@@@@@%.@% 
+  0x00, 0x02, 0x43, 0x00, 0x3f, 0x80,  //....+....@% 
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0x40,  //........+@+ 
+  0x00, 0x00, 0x00, 0x00, 0xee, 0x00,  //........@@. 
+  0xa8, 0x00, 0x00, 0x0a, 0xf6, 0x00,  //%%.....%@+. 
+  0x8f, 0xe9, 0x78, 0xdf, 0xa0, 0x00,  //%@@%+%@@%.. 
+  0x03, 0x9d, 0xff, 0xc5, 0x00, 0x00,  //..%@@@@+... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+003a (:) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+003b (;) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+003c (<) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+003d (=) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+003e (>) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+003f (?) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0040 (@) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0041 (A) , Width: 15 */
+  0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00,  //......+@%...... 
+  0x00, 0x00, 0x00, 0xbf, 0xf1, 0x00, 0x00, 0x00,  //......%@@...... 
+  0x00, 0x00, 0x02, 0xfa, 0xf8, 0x00, 0x00, 0x00,  //......@%@%..... 
+  0x00, 0x00, 0x09, 0xf1, 0xae, 0x00, 0x00, 0x00,  //.....%@.%@..... 
+  0x00, 0x00, 0x1f, 0xa0, 0x3f, 0x60, 0x00, 0x00,  //.....@%..@+.... 
+  0x00, 0x00, 0x7f, 0x40, 0x0d, 0xd0, 0x00, 0x00,  //....+@+..@@.... 
+  0x00, 0x00, 0xed, 0x00, 0x06, 0xf4, 0x00, 0x00,  //....@@...+@+... 
+  0x00, 0x05, 0xf6, 0x00, 0x00, 0xeb, 0x00, 0x00,  //...+@+....@%... 
+  0x00, 0x0c, 0xf0, 0x00, 0x00, 0x8f, 0x20, 0x00,  //...@@.....%@... 
+  0x00, 0x3f, 0xa1, 0x11, 0x11, 0x3f, 0x90, 0x00,  //...@%......@%.. 
+  0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x00,  //..%@@@@@@@@@@.. 
+  0x01, 0xfc, 0x44, 0x44, 0x44, 0x46, 0xf8, 0x00,  //..@@++++++++@%. 
+  0x08, 0xf4, 0x00, 0x00, 0x00, 0x00, 0xce, 0x00,  //.%@+........@@. 
+  0x0e, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x60,  //.@@.........+@+ 
+  0x6f, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xd0,  //+@+..........@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+
+
+  /*Unicode: U+0042 (B) , Width: 11 */
+  0xff, 0xff, 0xff, 0xfd, 0x70, 0x00,  //@@@@@@@@+.. 
+  0xfd, 0x66, 0x66, 0x7b, 0xfc, 0x00,  //@@+++++%@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x8f, 0x60,  //@%......%@+ 
+  0xfb, 0x00, 0x00, 0x00, 0x1f, 0xa0,  //@%.......@% 
+  0xfb, 0x00, 0x00, 0x00, 0x0f, 0xa0,  //@%.......@% 
+  0xfb, 0x00, 0x00, 0x00, 0x5f, 0x70,  //@%......+@+ 
+  0xfb, 0x11, 0x11, 0x26, 0xec, 0x00,  //@%.....+@@. 
+  0xff, 0xff, 0xff, 0xff, 0xd1, 0x00,  //@@@@@@@@@.. 
+  0xfc, 0x44, 0x44, 0x58, 0xee, 0x20,  //@@+++++%@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x2f, 0xb0,  //@%.......@% 
+  0xfb, 0x00, 0x00, 0x00, 0x0c, 0xf0,  //@%.......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0x0c, 0xf0,  //@%.......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0x3f, 0xb0,  //@%.......@% 
+  0xfd, 0x66, 0x66, 0x79, 0xff, 0x30,  //@@+++++%@@. 
+  0xff, 0xff, 0xff, 0xfd, 0x92, 0x00,  //@@@@@@@@%.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0043 (C) , Width: 12 */
+  0x00, 0x03, 0xad, 0xff, 0xd9, 0x20,  //....%@@@@%.. 
+  0x00, 0x8f, 0xe9, 0x77, 0xae, 0xf8,  //..%@@%++%@@% 
+  0x07, 0xf9, 0x00, 0x00, 0x00, 0x89,  //.+@%......%% 
+  0x2f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%......... 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x00,  //%@.......... 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......... 
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......... 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%.......... 
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......... 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@.......... 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x00,  //%@.......... 
+  0x2f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%......... 
+  0x07, 0xf9, 0x00, 0x00, 0x00, 0x89,  //.+@%......%% 
+  0x00, 0x8f, 0xe9, 0x77, 0xae, 0xf8,  //..%@@%++%@@% 
+  0x00, 0x03, 0xae, 0xff, 0xd9, 0x20,  //....%@@@@%.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+
+
+  /*Unicode: U+0044 (D) , Width: 13 */
+  0xff, 0xff, 0xff, 0xeb, 0x60, 0x00, 0x00,  //@@@@@@@%+.... 
+  0xfd, 0x66, 0x67, 0x8c, 0xfe, 0x30, 0x00,  //@@++++%@@@... 
+  0xfb, 0x00, 0x00, 0x00, 0x3d, 0xf3, 0x00,  //@%.......@@.. 
+  0xfb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00,  //@%........@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x40,  //@%........%@+ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xa0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xa0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x40,  //@%........%@+ 
+  0xfb, 0x00, 0x00, 0x00, 0x02, 0xfd, 0x00,  //@%........@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x3d, 0xf3, 0x00,  //@%.......@@.. 
+  0xfd, 0x66, 0x67, 0x8c, 0xfe, 0x30, 0x00,  //@@++++%@@@... 
+  0xff, 0xff, 0xff, 0xeb, 0x60, 0x00, 0x00,  //@@@@@@@%+.... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+
+
+  /*Unicode: U+0045 (E) , Width: 10 */
+  0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@@+ 
+  0xfd, 0x66, 0x66, 0x66, 0x62,  //@@+++++++. 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x11, 0x11, 0x11, 0x10,  //@%........ 
+  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@. 
+  0xfc, 0x44, 0x44, 0x44, 0x40,  //@@+++++++. 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfd, 0x66, 0x66, 0x66, 0x62,  //@@+++++++. 
+  0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0046 (F) , Width: 10 */
+  0xff, 0xff, 0xff, 0xff, 0xf3,  //@@@@@@@@@. 
+  0xfd, 0x66, 0x66, 0x66, 0x61,  //@@+++++++. 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x11, 0x11, 0x11, 0x10,  //@%........ 
+  0xff, 0xff, 0xff, 0xff, 0xd0,  //@@@@@@@@@. 
+  0xfc, 0x44, 0x44, 0x44, 0x30,  //@@++++++.. 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0047 (G) , Width: 13 */
+  0x00, 0x02, 0x9d, 0xff, 0xeb, 0x60, 0x00,  //....%@@@@%+.. 
+  0x00, 0x7f, 0xe9, 0x77, 0x9d, 0xfe, 0x30,  //..+@@%++%@@@. 
+  0x06, 0xfa, 0x00, 0x00, 0x00, 0x4d, 0x20,  //.+@%......+@. 
+  0x1f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@%.......... 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@........... 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@........... 
+  0xec, 0x00, 0x00, 0x01, 0x11, 0x11, 0x10,  //@@........... 
+  0xfb, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xb0,  //@%.....@@@@@% 
+  0xec, 0x00, 0x00, 0x03, 0x44, 0x4f, 0xb0,  //@@......+++@% 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@@.........@% 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //%@.........@% 
+  0x1f, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //.@@........@% 
+  0x07, 0xfa, 0x10, 0x00, 0x00, 0x0f, 0xb0,  //.+@%.......@% 
+  0x00, 0x7f, 0xfa, 0x76, 0x7a, 0xef, 0xb0,  //..+@@%+++%@@% 
+  0x00, 0x02, 0x8c, 0xef, 0xfd, 0xb7, 0x10,  //....%@@@@@%+. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+
+
+  /*Unicode: U+0048 (H) , Width: 13 */
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x11, 0x11, 0x11, 0x11, 0x1f, 0xb0,  //@%.........@% 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //@@@@@@@@@@@@% 
+  0xfc, 0x44, 0x44, 0x44, 0x44, 0x4f, 0xb0,  //@@+++++++++@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb0,  //@%.........@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+
+
+  /*Unicode: U+0049 (I) , Width: 2 */
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+
+
+  /*Unicode: U+004a (J) , Width: 5 */
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x0f, 0xb0,  //...@% 
+  0x00, 0x1f, 0x90,  //...@% 
+  0x22, 0xaf, 0x60,  //..%@+ 
+  0xff, 0xfb, 0x00,  //@@@%. 
+  0x44, 0x20, 0x00,  //++... 
+  0x00, 0x00, 0x00,  //..... 
+
+
+  /*Unicode: U+004b (K) , Width: 12 */
+  0xfb, 0x00, 0x00, 0x00, 0x7f, 0xb0,  //@%......+@%. 
+  0xfb, 0x00, 0x00, 0x08, 0xfa, 0x00,  //@%.....%@%.. 
+  0xfb, 0x00, 0x00, 0x9f, 0x90, 0x00,  //@%....%@%... 
+  0xfb, 0x00, 0x0a, 0xf8, 0x00, 0x00,  //@%...%@%.... 
+  0xfb, 0x00, 0xbf, 0x70, 0x00, 0x00,  //@%..%@+..... 
+  0xfb, 0x0b, 0xf6, 0x00, 0x00, 0x00,  //@%.%@+...... 
+  0xfc, 0xcf, 0x50, 0x00, 0x00, 0x00,  //@@@@+....... 
+  0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,  //@@@@........ 
+  0xfb, 0x9f, 0xb0, 0x00, 0x00, 0x00,  //@%%@%....... 
+  0xfb, 0x07, 0xfc, 0x00, 0x00, 0x00,  //@%.+@@...... 
+  0xfb, 0x00, 0x6f, 0xc1, 0x00, 0x00,  //@%..+@@..... 
+  0xfb, 0x00, 0x05, 0xfd, 0x10, 0x00,  //@%...+@@.... 
+  0xfb, 0x00, 0x00, 0x4f, 0xd2, 0x00,  //@%....+@@... 
+  0xfb, 0x00, 0x00, 0x03, 0xfe, 0x20,  //@%......@@.. 
+  0xfb, 0x00, 0x00, 0x00, 0x3e, 0xe3,  //@%.......@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+
+
+  /*Unicode: U+004c (L) , Width: 10 */
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfd, 0x77, 0x77, 0x77, 0x71,  //@@+++++++. 
+  0xff, 0xff, 0xff, 0xff, 0xf3,  //@@@@@@@@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+004d (M) , Width: 14 */
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf,  //@@..........@@ 
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x02, 0xff,  //@@..........@@ 
+  0xff, 0xa0, 0x00, 0x00, 0x00, 0x09, 0xff,  //@@%........%@@ 
+  0xff, 0xf1, 0x00, 0x00, 0x00, 0x0f, 0xff,  //@@@........@@@ 
+  0xfc, 0xf7, 0x00, 0x00, 0x00, 0x6f, 0xcf,  //@@@+......+@@@ 
+  0xfb, 0x9e, 0x00, 0x00, 0x00, 0xd9, 0xbf,  //@%%@......@%%@ 
+  0xfb, 0x2f, 0x50, 0x00, 0x04, 0xf2, 0xbf,  //@%.@+....+@.%@ 
+  0xfb, 0x0c, 0xb0, 0x00, 0x0a, 0xb0, 0xbf,  //@%.@%....%%.%@ 
+  0xfb, 0x05, 0xf2, 0x00, 0x1f, 0x50, 0xbf,  //@%.+@....@+.%@ 
+  0xfb, 0x00, 0xe9, 0x00, 0x8e, 0x00, 0xbf,  //@%..@%..%@..%@ 
+  0xfb, 0x00, 0x7f, 0x00, 0xe7, 0x00, 0xbf,  //@%..+@..@+..%@ 
+  0xfb, 0x00, 0x1f, 0x65, 0xf1, 0x00, 0xbf,  //@%...@++@...%@ 
+  0xfb, 0x00, 0x09, 0xdc, 0xa0, 0x00, 0xbf,  //@%...%@@%...%@ 
+  0xfb, 0x00, 0x03, 0xff, 0x30, 0x00, 0xbf,  //@%....@@....%@ 
+  0xfb, 0x00, 0x00, 0xcc, 0x00, 0x00, 0xbf,  //@%....@@....%@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+
+
+  /*Unicode: U+004e (N) , Width: 12 */
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@@........%@ 
+  0xff, 0x80, 0x00, 0x00, 0x00, 0xbf,  //@@%.......%@ 
+  0xff, 0xf3, 0x00, 0x00, 0x00, 0xbf,  //@@@.......%@ 
+  0xfc, 0xde, 0x10, 0x00, 0x00, 0xbf,  //@@@@......%@ 
+  0xfb, 0x2f, 0xb0, 0x00, 0x00, 0xbf,  //@%.@%.....%@ 
+  0xfb, 0x06, 0xf7, 0x00, 0x00, 0xbf,  //@%.+@+....%@ 
+  0xfb, 0x00, 0xaf, 0x30, 0x00, 0xbf,  //@%..%@....%@ 
+  0xfb, 0x00, 0x0d, 0xd0, 0x00, 0xbf,  //@%...@@...%@ 
+  0xfb, 0x00, 0x03, 0xfa, 0x00, 0xbf,  //@%....@%..%@ 
+  0xfb, 0x00, 0x00, 0x7f, 0x60, 0xbf,  //@%....+@+.%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf2, 0xbf,  //@%.....%@.%@ 
+  0xfb, 0x00, 0x00, 0x01, 0xed, 0xbf,  //@%......@@%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x3f, 0xff,  //@%.......@@@ 
+  0xfb, 0x00, 0x00, 0x00, 0x07, 0xff,  //@%.......+@@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+
+
+  /*Unicode: U+004f (O) , Width: 14 */
+  0x00, 0x03, 0xae, 0xff, 0xd8, 0x10, 0x00,  //....%@@@@%.... 
+  0x00, 0x9f, 0xe9, 0x77, 0xaf, 0xf5, 0x00,  //..%@@%++%@@+.. 
+  0x07, 0xf9, 0x00, 0x00, 0x01, 0xcf, 0x30,  //.+@%......@@.. 
+  0x2f, 0xb0, 0x00, 0x00, 0x00, 0x1e, 0xd0,  //.@%........@@. 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x07, 0xf4,  //%@.........+@+ 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8,  //@@..........@% 
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa,  //@@..........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,  //@%..........@% 
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfa,  //@@..........@% 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8,  //@@..........@% 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x08, 0xf3,  //%@.........%@. 
+  0x2f, 0xb0, 0x00, 0x00, 0x00, 0x1e, 0xd0,  //.@%........@@. 
+  0x08, 0xf9, 0x00, 0x00, 0x01, 0xcf, 0x30,  //.%@%......@@.. 
+  0x00, 0x9f, 0xe9, 0x77, 0xaf, 0xf4, 0x00,  //..%@@%++%@@+.. 
+  0x00, 0x03, 0xae, 0xff, 0xd8, 0x10, 0x00,  //....%@@@@%.... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+
+
+  /*Unicode: U+0050 (P) , Width: 11 */
+  0xff, 0xff, 0xff, 0xfd, 0x91, 0x00,  //@@@@@@@@%.. 
+  0xfd, 0x66, 0x66, 0x7a, 0xfe, 0x20,  //@@+++++%@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x3f, 0xa0,  //@%.......@% 
+  0xfb, 0x00, 0x00, 0x00, 0x0c, 0xe0,  //@%.......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0x0c, 0xf0,  //@%.......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0x1f, 0xc0,  //@%.......@@ 
+  0xfb, 0x11, 0x11, 0x25, 0xdf, 0x40,  //@%.....+@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xd4, 0x00,  //@@@@@@@@@+. 
+  0xfc, 0x44, 0x44, 0x42, 0x00, 0x00,  //@@+++++.... 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......... 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......... 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......... 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......... 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......... 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //@%......... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0051 (Q) , Width: 14 */
+  0x00, 0x03, 0xae, 0xff, 0xd8, 0x10, 0x00,  //....%@@@@%.... 
+  0x00, 0x9f, 0xe9, 0x77, 0xaf, 0xf5, 0x00,  //..%@@%++%@@+.. 
+  0x07, 0xf9, 0x00, 0x00, 0x01, 0xcf, 0x30,  //.+@%......@@.. 
+  0x2f, 0xb0, 0x00, 0x00, 0x00, 0x1e, 0xd0,  //.@%........@@. 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x07, 0xf4,  //%@.........+@+ 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8,  //@@..........@% 
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa,  //@@..........@% 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,  //@%..........@% 
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfa,  //@@..........@% 
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8,  //@@..........@% 
+  0x8f, 0x30, 0x00, 0x00, 0x00, 0x08, 0xf4,  //%@.........%@+ 
+  0x2f, 0xb0, 0x00, 0x00, 0x00, 0x1e, 0xd0,  //.@%........@@. 
+  0x07, 0xf9, 0x00, 0x00, 0x01, 0xcf, 0x40,  //.+@%......@@+. 
+  0x00, 0x8f, 0xe9, 0x77, 0xaf, 0xf5, 0x00,  //..%@@%++%@@+.. 
+  0x00, 0x03, 0xae, 0xff, 0xfc, 0x10, 0x00,  //....%@@@@@.... 
+  0x00, 0x00, 0x00, 0x01, 0xee, 0x10, 0x00,  //........@@.... 
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xd1, 0x00,  //........+@@... 
+  0x00, 0x00, 0x00, 0x00, 0x07, 0xfd, 0x00,  //.........+@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00,  //..........++.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+
+
+  /*Unicode: U+0052 (R) , Width: 12 */
+  0xff, 0xff, 0xff, 0xfd, 0x91, 0x00,  //@@@@@@@@%... 
+  0xfd, 0x66, 0x66, 0x7a, 0xfe, 0x20,  //@@+++++%@@.. 
+  0xfb, 0x00, 0x00, 0x00, 0x4f, 0xb0,  //@%......+@%. 
+  0xfb, 0x00, 0x00, 0x00, 0x0c, 0xf0,  //@%.......@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x0c, 0xf0,  //@%.......@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x1f, 0xc0,  //@%.......@@. 
+  0xfb, 0x11, 0x11, 0x25, 0xdf, 0x40,  //@%.....+@@+. 
+  0xff, 0xff, 0xff, 0xff, 0xc3, 0x00,  //@@@@@@@@@... 
+  0xfc, 0x44, 0x44, 0x6d, 0xd2, 0x00,  //@@+++++@@... 
+  0xfb, 0x00, 0x00, 0x01, 0xfb, 0x00,  //@%......@%.. 
+  0xfb, 0x00, 0x00, 0x00, 0xaf, 0x20,  //@%......%@.. 
+  0xfb, 0x00, 0x00, 0x00, 0x4f, 0x70,  //@%......+@+. 
+  0xfb, 0x00, 0x00, 0x00, 0x0e, 0xd0,  //@%.......@@. 
+  0xfb, 0x00, 0x00, 0x00, 0x08, 0xf3,  //@%.......%@. 
+  0xfb, 0x00, 0x00, 0x00, 0x03, 0xf9,  //@%........@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+
+
+  /*Unicode: U+0053 (S) , Width: 12 */
+  0x00, 0x06, 0xce, 0xfe, 0xb6, 0x00,  //...+@@@@%+.. 
+  0x00, 0xcf, 0xb7, 0x78, 0xcf, 0xe2,  //..@@%++%@@@. 
+  0x08, 0xf5, 0x00, 0x00, 0x04, 0xd2,  //.%@+.....+@. 
+  0x0e, 0xd0, 0x00, 0x00, 0x00, 0x00,  //.@@......... 
+  0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00,  //.@@......... 
+  0x0c, 0xf4, 0x00, 0x00, 0x00, 0x00,  //.@@+........ 
+  0x03, 0xff, 0xb5, 0x10, 0x00, 0x00,  //..@@%+...... 
+  0x00, 0x2a, 0xff, 0xfd, 0x83, 0x00,  //...%@@@@%... 
+  0x00, 0x00, 0x04, 0x8c, 0xff, 0xa0,  //.....+%@@@%. 
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0xf6,  //.........%@+ 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xfa,  //..........@% 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xfa,  //..........@% 
+  0x0d, 0x60, 0x00, 0x00, 0x09, 0xf5,  //.@+......%@+ 
+  0x0b, 0xfe, 0xa7, 0x68, 0xdf, 0x90,  //.%@@%++%@@%. 
+  0x00, 0x49, 0xdf, 0xfe, 0xb4, 0x00,  //..+%@@@@%+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+
+
+  /*Unicode: U+0054 (T) , Width: 12 */
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@ 
+  0x66, 0x66, 0x6d, 0xf6, 0x66, 0x66,  //+++++@@+++++ 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x0b, 0xf0, 0x00, 0x00,  //.....%@..... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+
+
+  /*Unicode: U+0055 (U) , Width: 12 */
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0xbf,  //@%........%@ 
+  0xdd, 0x00, 0x00, 0x00, 0x00, 0xdd,  //@@........@@ 
+  0xaf, 0x20, 0x00, 0x00, 0x02, 0xf9,  //%@........@% 
+  0x3f, 0xc1, 0x00, 0x00, 0x1c, 0xf2,  //.@@......@@. 
+  0x07, 0xff, 0xa7, 0x7a, 0xff, 0x60,  //.+@@%++%@@+. 
+  0x00, 0x3a, 0xdf, 0xfd, 0x92, 0x00,  //...%@@@@%... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............ 
+
+
+  /*Unicode: U+0056 (V) , Width: 15 */
+  0xbf, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x60,  //%@..........+@+ 
+  0x4f, 0x80, 0x00, 0x00, 0x00, 0x00, 0xce, 0x00,  //+@%.........@@. 
+  0x0d, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00,  //.@@.........@%. 
+  0x06, 0xf5, 0x00, 0x00, 0x00, 0x0a, 0xf1, 0x00,  //.+@+.......%@.. 
+  0x00, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xa0, 0x00,  //..@@.......@%.. 
+  0x00, 0x8f, 0x30, 0x00, 0x00, 0x8f, 0x30, 0x00,  //..%@......%@... 
+  0x00, 0x2f, 0xa0, 0x00, 0x00, 0xec, 0x00, 0x00,  //...@%.....@@... 
+  0x00, 0x0b, 0xf1, 0x00, 0x05, 0xf5, 0x00, 0x00,  //...%@....+@+... 
+  0x00, 0x04, 0xf7, 0x00, 0x0c, 0xe0, 0x00, 0x00,  //...+@+...@@.... 
+  0x00, 0x00, 0xde, 0x00, 0x3f, 0x70, 0x00, 0x00,  //....@@...@+.... 
+  0x00, 0x00, 0x6f, 0x50, 0xaf, 0x10, 0x00, 0x00,  //....+@+.%@..... 
+  0x00, 0x00, 0x0e, 0xc1, 0xf9, 0x00, 0x00, 0x00,  //.....@@.@%..... 
+  0x00, 0x00, 0x08, 0xfb, 0xf2, 0x00, 0x00, 0x00,  //.....%@%@...... 
+  0x00, 0x00, 0x01, 0xff, 0xb0, 0x00, 0x00, 0x00,  //......@@%...... 
+  0x00, 0x00, 0x00, 0xaf, 0x40, 0x00, 0x00, 0x00,  //......%@+...... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+
+
+  /*Unicode: U+0057 (W) , Width: 23 */
+  0x1f, 0xa0, 0x00, 0x00, 0x00, 0x2f, 0x80, 0x00, 0x00, 0x00, 0x3f, 0x70,  //.@%........@%........@+ 
+  0x0c, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x9f, 0x10,  //.@@.......+@@.......%@. 
+  0x06, 0xf4, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0xec, 0x00,  //.+@+......@@@.......@@. 
+  0x01, 0xfa, 0x00, 0x00, 0x02, 0xf7, 0xf9, 0x00, 0x00, 0x04, 0xf6, 0x00,  //..@%......@+@%.....+@+. 
+  0x00, 0xbf, 0x00, 0x00, 0x08, 0xf1, 0xbe, 0x00, 0x00, 0x09, 0xf1, 0x00,  //..%@.....%@.%@.....%@.. 
+  0x00, 0x5f, 0x50, 0x00, 0x0d, 0xb0, 0x5f, 0x40, 0x00, 0x0e, 0xb0, 0x00,  //..+@+....@%.+@+....@%.. 
+  0x00, 0x0f, 0xa0, 0x00, 0x3f, 0x50, 0x0f, 0x90, 0x00, 0x4f, 0x50, 0x00,  //...@%....@+..@%...+@+.. 
+  0x00, 0x0a, 0xf0, 0x00, 0x9f, 0x00, 0x0a, 0xe0, 0x00, 0x9f, 0x00, 0x00,  //...%@...%@...%@...%@... 
+  0x00, 0x05, 0xf5, 0x00, 0xea, 0x00, 0x04, 0xf4, 0x00, 0xea, 0x00, 0x00,  //...+@+..@%...+@+..@%... 
+  0x00, 0x00, 0xfa, 0x04, 0xf5, 0x00, 0x00, 0xe9, 0x04, 0xf4, 0x00, 0x00,  //....@%.+@+....@%.+@+... 
+  0x00, 0x00, 0x9f, 0x09, 0xe0, 0x00, 0x00, 0x9e, 0x0a, 0xe0, 0x00, 0x00,  //....%@.%@.....%@.%@.... 
+  0x00, 0x00, 0x4f, 0x5e, 0x90, 0x00, 0x00, 0x4f, 0x5f, 0x90, 0x00, 0x00,  //....+@+@%.....+@+@%.... 
+  0x00, 0x00, 0x0e, 0xef, 0x40, 0x00, 0x00, 0x0e, 0xef, 0x40, 0x00, 0x00,  //.....@@@+......@@@+.... 
+  0x00, 0x00, 0x09, 0xfe, 0x00, 0x00, 0x00, 0x09, 0xfe, 0x00, 0x00, 0x00,  //.....%@@.......%@@..... 
+  0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00,  //......@%........@%..... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+
+
+  /*Unicode: U+0058 (X) , Width: 14 */
+  0x3f, 0xd0, 0x00, 0x00, 0x00, 0x2f, 0xd0,  //.@@........@@. 
+  0x06, 0xf9, 0x00, 0x00, 0x00, 0xdf, 0x30,  //.+@%......@@.. 
+  0x00, 0xbf, 0x40, 0x00, 0x09, 0xf6, 0x00,  //..%@+....%@+.. 
+  0x00, 0x1e, 0xe1, 0x00, 0x4f, 0xb0, 0x00,  //...@@...+@%... 
+  0x00, 0x03, 0xfb, 0x01, 0xee, 0x10, 0x00,  //....@%..@@.... 
+  0x00, 0x00, 0x7f, 0x7b, 0xf3, 0x00, 0x00,  //....+@+%@..... 
+  0x00, 0x00, 0x0b, 0xff, 0x70, 0x00, 0x00,  //.....%@@+..... 
+  0x00, 0x00, 0x05, 0xff, 0x10, 0x00, 0x00,  //.....+@@...... 
+  0x00, 0x00, 0x1e, 0xef, 0xa0, 0x00, 0x00,  //.....@@@%..... 
+  0x00, 0x00, 0xbf, 0x38, 0xf6, 0x00, 0x00,  //....%@.%@+.... 
+  0x00, 0x07, 0xf7, 0x00, 0xcf, 0x30, 0x00,  //...+@+..@@.... 
+  0x00, 0x3f, 0xb0, 0x00, 0x1e, 0xd0, 0x00,  //...@%....@@... 
+  0x01, 0xee, 0x10, 0x00, 0x05, 0xfa, 0x00,  //..@@.....+@%.. 
+  0x0b, 0xf4, 0x00, 0x00, 0x00, 0x9f, 0x60,  //.%@+......%@+. 
+  0x7f, 0x90, 0x00, 0x00, 0x00, 0x0d, 0xf2,  //+@%........@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+
+
+  /*Unicode: U+0059 (Y) , Width: 13 */
+  0xf7, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x40,  //@+........%@+ 
+  0xdf, 0x20, 0x00, 0x00, 0x05, 0xf9, 0x00,  //@@.......+@%. 
+  0x3f, 0xb0, 0x00, 0x00, 0x1e, 0xe0, 0x00,  //.@%......@@.. 
+  0x09, 0xf6, 0x00, 0x00, 0x9f, 0x40, 0x00,  //.%@+....%@+.. 
+  0x00, 0xde, 0x10, 0x04, 0xfa, 0x00, 0x00,  //..@@...+@%... 
+  0x00, 0x4f, 0xa0, 0x0d, 0xe1, 0x00, 0x00,  //..+@%..@@.... 
+  0x00, 0x09, 0xf5, 0x8f, 0x50, 0x00, 0x00,  //...%@+%@+.... 
+  0x00, 0x00, 0xee, 0xfa, 0x00, 0x00, 0x00,  //....@@@%..... 
+  0x00, 0x00, 0x4f, 0xe1, 0x00, 0x00, 0x00,  //....+@@...... 
+  0x00, 0x00, 0x0f, 0xb0, 0x00, 0x00, 0x00,  //.....@%...... 
+  0x00, 0x00, 0x0f, 0xb0, 0x00, 0x00, 0x00,  //.....@%...... 
+  0x00, 0x00, 0x0f, 0xb0, 0x00, 0x00, 0x00,  //.....@%...... 
+  0x00, 0x00, 0x0f, 0xb0, 0x00, 0x00, 0x00,  //.....@%...... 
+  0x00, 0x00, 0x0f, 0xb0, 0x00, 0x00, 0x00,  //.....@%...... 
+  0x00, 0x00, 0x0f, 0xb0, 0x00, 0x00, 0x00,  //.....@%...... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+
+
+  /*Unicode: U+005a (Z) , Width: 11 */
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@ 
+  0x66, 0x66, 0x66, 0x66, 0x9f, 0xc0,  //++++++++%@@ 
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x20,  //........@@. 
+  0x00, 0x00, 0x00, 0x09, 0xf5, 0x00,  //.......%@+. 
+  0x00, 0x00, 0x00, 0x5f, 0xa0, 0x00,  //......+@%.. 
+  0x00, 0x00, 0x01, 0xed, 0x00, 0x00,  //......@@... 
+  0x00, 0x00, 0x0c, 0xf3, 0x00, 0x00,  //.....@@.... 
+  0x00, 0x00, 0x7f, 0x70, 0x00, 0x00,  //....+@+.... 
+  0x00, 0x03, 0xfb, 0x00, 0x00, 0x00,  //....@%..... 
+  0x00, 0x0d, 0xe1, 0x00, 0x00, 0x00,  //...@@...... 
+  0x00, 0xaf, 0x40, 0x00, 0x00, 0x00,  //..%@+...... 
+  0x06, 0xf9, 0x00, 0x00, 0x00, 0x00,  //.+@%....... 
+  0x2f, 0xd0, 0x00, 0x00, 0x00, 0x00,  //.@@........ 
+  0xcf, 0x96, 0x66, 0x66, 0x66, 0x60,  //@@%++++++++ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+005b ([) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+005c (\) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+005d (]) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+005e (^) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+005f (_) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0060 (`) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+0061 (a) , Width: 10 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x6d, 0xfe, 0xa1, 0xbf,  //..+@@@%.%@ 
+  0x09, 0xfc, 0x77, 0xbd, 0xcf,  //.%@@++%@@@ 
+  0x4f, 0xa0, 0x00, 0x08, 0xff,  //+@%....%@@ 
+  0xbf, 0x10, 0x00, 0x00, 0xff,  //%@......@@ 
+  0xec, 0x00, 0x00, 0x00, 0xcf,  //@@......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0xbf,  //@%......%@ 
+  0xec, 0x00, 0x00, 0x00, 0xcf,  //@@......@@ 
+  0xbf, 0x00, 0x00, 0x01, 0xff,  //%@......@@ 
+  0x5f, 0x90, 0x00, 0x09, 0xff,  //+@%....%@@ 
+  0x0a, 0xfc, 0x77, 0xcd, 0xcf,  //.%@@++@@@@ 
+  0x00, 0x7d, 0xfe, 0xa1, 0xbf,  //..+@@@%.%@ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0062 (b) , Width: 10 */
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x1a, 0xef, 0xd7, 0x00,  //@%.%@@@+.. 
+  0xfc, 0xdc, 0x77, 0xcf, 0xa0,  //@@@@++@@%. 
+  0xff, 0x90, 0x00, 0x09, 0xf5,  //@@%....%@+ 
+  0xff, 0x10, 0x00, 0x01, 0xfb,  //@@......@% 
+  0xfc, 0x00, 0x00, 0x00, 0xce,  //@@......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0xbf,  //@%......%@ 
+  0xfc, 0x00, 0x00, 0x00, 0xce,  //@@......@@ 
+  0xff, 0x10, 0x00, 0x01, 0xfb,  //@@......@% 
+  0xff, 0x90, 0x00, 0x0a, 0xf4,  //@@%....%@+ 
+  0xfc, 0xdc, 0x77, 0xcf, 0xa0,  //@@@@++@@%. 
+  0xfb, 0x1a, 0xef, 0xd6, 0x00,  //@%.%@@@+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0063 (c) , Width: 9 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x5c, 0xff, 0xd7, 0x00,  //..+@@@@+. 
+  0x08, 0xfc, 0x77, 0xaf, 0xa0,  //.%@@++%@% 
+  0x4f, 0xa0, 0x00, 0x02, 0x30,  //+@%...... 
+  0xbf, 0x10, 0x00, 0x00, 0x00,  //%@....... 
+  0xec, 0x00, 0x00, 0x00, 0x00,  //@@....... 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%....... 
+  0xec, 0x00, 0x00, 0x00, 0x00,  //@@....... 
+  0xbf, 0x10, 0x00, 0x00, 0x00,  //%@....... 
+  0x4f, 0xa0, 0x00, 0x02, 0x30,  //+@%...... 
+  0x09, 0xfc, 0x77, 0xaf, 0x90,  //.%@@++%@% 
+  0x00, 0x5c, 0xff, 0xd7, 0x00,  //..+@@@@+. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+
+
+  /*Unicode: U+0064 (d) , Width: 10 */
+  0x00, 0x00, 0x00, 0x00, 0xbf,  //........%@ 
+  0x00, 0x00, 0x00, 0x00, 0xbf,  //........%@ 
+  0x00, 0x00, 0x00, 0x00, 0xbf,  //........%@ 
+  0x00, 0x00, 0x00, 0x00, 0xbf,  //........%@ 
+  0x00, 0x7d, 0xfe, 0xa1, 0xbf,  //..+@@@%.%@ 
+  0x0a, 0xfc, 0x77, 0xcd, 0xcf,  //.%@@++@@@@ 
+  0x5f, 0x90, 0x00, 0x09, 0xff,  //+@%....%@@ 
+  0xbf, 0x00, 0x00, 0x01, 0xff,  //%@......@@ 
+  0xec, 0x00, 0x00, 0x00, 0xcf,  //@@......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0xbf,  //@%......%@ 
+  0xec, 0x00, 0x00, 0x00, 0xcf,  //@@......@@ 
+  0xbf, 0x10, 0x00, 0x01, 0xff,  //%@......@@ 
+  0x5f, 0xa0, 0x00, 0x09, 0xff,  //+@%....%@@ 
+  0x0a, 0xfc, 0x77, 0xcd, 0xcf,  //.%@@++@@@@ 
+  0x00, 0x6d, 0xfe, 0xa1, 0xbf,  //..+@@@%.%@ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0065 (e) , Width: 10 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x5c, 0xff, 0xc4, 0x00,  //..+@@@@+.. 
+  0x08, 0xfb, 0x77, 0xbf, 0x60,  //.%@%++%@+. 
+  0x4f, 0x60, 0x00, 0x08, 0xf0,  //+@+....%@. 
+  0xbe, 0x11, 0x11, 0x13, 0xf5,  //%@......@+ 
+  0xef, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@+ 
+  0xfc, 0x44, 0x44, 0x44, 0x42,  //@@+++++++. 
+  0xed, 0x00, 0x00, 0x00, 0x00,  //@@........ 
+  0xbf, 0x10, 0x00, 0x00, 0x00,  //%@........ 
+  0x4f, 0xa0, 0x00, 0x00, 0x70,  //+@%.....+. 
+  0x09, 0xfd, 0x87, 0x9e, 0xf2,  //.%@@%+%@@. 
+  0x00, 0x5b, 0xef, 0xea, 0x20,  //..+%@@@%.. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0066 (f) , Width: 7 */
+  0x00, 0xaf, 0xa7, 0x20,  //..%@%+. 
+  0x00, 0xed, 0x00, 0x00,  //..@@... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0xff, 0xff, 0xff, 0x00,  //@@@@@@. 
+  0x66, 0xfd, 0x66, 0x00,  //++@@++. 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+
+
+  /*Unicode: U+0067 (g) , Width: 10 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x7d, 0xfe, 0x91, 0xbf,  //..+@@@%.%@ 
+  0x0a, 0xfc, 0x77, 0xcd, 0xcf,  //.%@@++@@@@ 
+  0x5f, 0x90, 0x00, 0x09, 0xff,  //+@%....%@@ 
+  0xbf, 0x10, 0x00, 0x01, 0xff,  //%@......@@ 
+  0xec, 0x00, 0x00, 0x00, 0xcf,  //@@......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0xbf,  //@%......%@ 
+  0xec, 0x00, 0x00, 0x00, 0xcf,  //@@......@@ 
+  0xbf, 0x10, 0x00, 0x01, 0xff,  //%@......@@ 
+  0x5f, 0xa0, 0x00, 0x0a, 0xff,  //+@%....%@@ 
+  0x0a, 0xfc, 0x77, 0xcd, 0xbf,  //.%@@++@@%@ 
+  0x00, 0x7d, 0xfe, 0x91, 0xbf,  //..+@@@%.%@ 
+  0x00, 0x00, 0x00, 0x00, 0xce,  //........@@ 
+  0x00, 0x00, 0x00, 0x02, 0xf9,  //........@% 
+  0x0c, 0xc8, 0x66, 0x8e, 0xe2,  //.@@%++%@@. 
+  0x02, 0x8d, 0xff, 0xe9, 0x20,  //..%@@@@%.. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0068 (h) , Width: 9 */
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%....... 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%....... 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%....... 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%....... 
+  0xfb, 0x1a, 0xef, 0xd5, 0x00,  //@%.%@@@+. 
+  0xfc, 0xeb, 0x78, 0xef, 0x50,  //@@@%+%@@+ 
+  0xff, 0x80, 0x00, 0x2f, 0xc0,  //@@%....@@ 
+  0xfe, 0x00, 0x00, 0x0c, 0xf0,  //@@.....@@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+
+
+  /*Unicode: U+0069 (i) , Width: 2 */
+  0xfb,  //@% 
+  0x64,  //++ 
+  0x00,  //.. 
+  0x00,  //.. 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+
+
+  /*Unicode: U+006a (j) , Width: 3 */
+  0x0f, 0xb0,  //.@% 
+  0x06, 0x40,  //.++ 
+  0x00, 0x00,  //... 
+  0x00, 0x00,  //... 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x0f, 0xb0,  //.@% 
+  0x2f, 0xa0,  //.@% 
+  0xdf, 0x50,  //@@+ 
+  0xe7, 0x00,  //@+. 
+  0x00, 0x00,  //... 
+
+
+  /*Unicode: U+006b (k) , Width: 10 */
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0x00, 0x00,  //@%........ 
+  0xfb, 0x00, 0x00, 0xbf, 0x50,  //@%....%@+. 
+  0xfb, 0x00, 0x0b, 0xf5, 0x00,  //@%...%@+.. 
+  0xfb, 0x00, 0xbf, 0x50, 0x00,  //@%..%@+... 
+  0xfb, 0x0b, 0xf5, 0x00, 0x00,  //@%.%@+.... 
+  0xfb, 0xbf, 0x50, 0x00, 0x00,  //@%%@+..... 
+  0xff, 0xfd, 0x00, 0x00, 0x00,  //@@@@...... 
+  0xfb, 0x7f, 0xc0, 0x00, 0x00,  //@%+@@..... 
+  0xfb, 0x06, 0xfc, 0x00, 0x00,  //@%.+@@.... 
+  0xfb, 0x00, 0x6f, 0xc0, 0x00,  //@%..+@@... 
+  0xfb, 0x00, 0x06, 0xfc, 0x10,  //@%...+@@.. 
+  0xfb, 0x00, 0x00, 0x5f, 0xc1,  //@%....+@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+006c (l) , Width: 2 */
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0xfb,  //@% 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+  0x00,  //.. 
+
+
+  /*Unicode: U+006d (m) , Width: 17 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x1f, 0x82, 0xaf, 0xfc, 0x40, 0x3b, 0xff, 0xc3, 0x00,  //.@%.%@@@+..%@@@.. 
+  0x0f, 0xae, 0xa7, 0x8f, 0xf6, 0xfa, 0x78, 0xff, 0x10,  //.@%@%+%@@+@%+%@@. 
+  0x0f, 0xf6, 0x00, 0x05, 0xff, 0x60, 0x00, 0x5f, 0x70,  //.@@+...+@@+...+@+ 
+  0x0f, 0xe0, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x0f, 0xa0,  //.@@.....@@.....@% 
+  0x0f, 0xb0, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0f, 0xb0,  //.@%.....@%.....@% 
+  0x0f, 0xb0, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0f, 0xb0,  //.@%.....@%.....@% 
+  0x0f, 0xb0, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0f, 0xb0,  //.@%.....@%.....@% 
+  0x0f, 0xb0, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0f, 0xb0,  //.@%.....@%.....@% 
+  0x0f, 0xb0, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0f, 0xb0,  //.@%.....@%.....@% 
+  0x0f, 0xb0, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0f, 0xb0,  //.@%.....@%.....@% 
+  0x0f, 0xb0, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x0f, 0xb0,  //.@%.....@%.....@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+
+
+  /*Unicode: U+006e (n) , Width: 10 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x1f, 0x81, 0xae, 0xfd, 0x60,  //.@%.%@@@+. 
+  0x0f, 0xae, 0xb7, 0x8e, 0xf5,  //.@%@%+%@@+ 
+  0x0f, 0xf8, 0x00, 0x02, 0xfc,  //.@@%....@@ 
+  0x0f, 0xe0, 0x00, 0x00, 0xcf,  //.@@.....@@ 
+  0x0f, 0xb0, 0x00, 0x00, 0xbf,  //.@%.....%@ 
+  0x0f, 0xb0, 0x00, 0x00, 0xbf,  //.@%.....%@ 
+  0x0f, 0xb0, 0x00, 0x00, 0xbf,  //.@%.....%@ 
+  0x0f, 0xb0, 0x00, 0x00, 0xbf,  //.@%.....%@ 
+  0x0f, 0xb0, 0x00, 0x00, 0xbf,  //.@%.....%@ 
+  0x0f, 0xb0, 0x00, 0x00, 0xbf,  //.@%.....%@ 
+  0x0f, 0xb0, 0x00, 0x00, 0xbf,  //.@%.....%@ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+006f (o) , Width: 10 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x5c, 0xff, 0xc5, 0x00,  //..+@@@@+.. 
+  0x09, 0xfc, 0x77, 0xcf, 0x80,  //.%@@++@@%. 
+  0x4f, 0x90, 0x00, 0x0a, 0xf4,  //+@%....%@+ 
+  0xbf, 0x10, 0x00, 0x01, 0xfb,  //%@......@% 
+  0xec, 0x00, 0x00, 0x00, 0xce,  //@@......@@ 
+  0xfb, 0x00, 0x00, 0x00, 0xbf,  //@%......%@ 
+  0xec, 0x00, 0x00, 0x00, 0xce,  //@@......@@ 
+  0xbf, 0x00, 0x00, 0x00, 0xfb,  //%@......@% 
+  0x4f, 0x80, 0x00, 0x08, 0xf4,  //+@%....%@+ 
+  0x09, 0xfb, 0x77, 0xbf, 0x80,  //.%@%++%@%. 
+  0x00, 0x6c, 0xff, 0xc5, 0x00,  //..+@@@@+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+0070 (p) , Width: 11 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x1f, 0x81, 0xae, 0xfd, 0x60, 0x00,  //.@%.%@@@+.. 
+  0x0f, 0x9d, 0xc7, 0x7c, 0xf9, 0x00,  //.@%@@++@@%. 
+  0x0f, 0xf9, 0x00, 0x00, 0xaf, 0x40,  //.@@%....%@+ 
+  0x0f, 0xf1, 0x00, 0x00, 0x1f, 0xb0,  //.@@......@% 
+  0x0f, 0xc0, 0x00, 0x00, 0x0c, 0xe0,  //.@@......@@ 
+  0x0f, 0xb0, 0x00, 0x00, 0x0b, 0xf0,  //.@%......%@ 
+  0x0f, 0xc0, 0x00, 0x00, 0x0c, 0xe0,  //.@@......@@ 
+  0x0f, 0xf1, 0x00, 0x00, 0x0f, 0xb0,  //.@@......@% 
+  0x0f, 0xf9, 0x00, 0x00, 0x9f, 0x50,  //.@@%....%@+ 
+  0x0f, 0xcd, 0xc7, 0x7c, 0xfa, 0x00,  //.@@@@++@@%. 
+  0x0f, 0xb1, 0xae, 0xfd, 0x70, 0x00,  //.@%.%@@@+.. 
+  0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x0f, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0071 (q) , Width: 11 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x6d, 0xfe, 0xa1, 0x7f, 0x10,  //..+@@@%.+@. 
+  0x09, 0xfc, 0x77, 0xbd, 0x9f, 0x00,  //.%@@++%@%@. 
+  0x4f, 0xa0, 0x00, 0x08, 0xff, 0x00,  //+@%....%@@. 
+  0xbf, 0x10, 0x00, 0x00, 0xff, 0x00,  //%@......@@. 
+  0xec, 0x00, 0x00, 0x00, 0xcf, 0x00,  //@@......@@. 
+  0xfb, 0x00, 0x00, 0x00, 0xbf, 0x00,  //@%......%@. 
+  0xec, 0x00, 0x00, 0x00, 0xcf, 0x00,  //@@......@@. 
+  0xbf, 0x00, 0x00, 0x01, 0xff, 0x00,  //%@......@@. 
+  0x5f, 0x90, 0x00, 0x09, 0xff, 0x00,  //+@%....%@@. 
+  0x0a, 0xfc, 0x77, 0xce, 0xcf, 0x00,  //.%@@++@@@@. 
+  0x00, 0x7d, 0xfe, 0xa1, 0xbf, 0x00,  //..+@@@%.%@. 
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x00,  //........%@. 
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x00,  //........%@. 
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x00,  //........%@. 
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x00,  //........%@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0072 (r) , Width: 7 */
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x1f, 0x82, 0xbf, 0xf0,  //.@%.%@@ 
+  0x0f, 0xae, 0xb7, 0x70,  //.@%@%++ 
+  0x0f, 0xf7, 0x00, 0x00,  //.@@+... 
+  0x0f, 0xe0, 0x00, 0x00,  //.@@.... 
+  0x0f, 0xb0, 0x00, 0x00,  //.@%.... 
+  0x0f, 0xb0, 0x00, 0x00,  //.@%.... 
+  0x0f, 0xb0, 0x00, 0x00,  //.@%.... 
+  0x0f, 0xb0, 0x00, 0x00,  //.@%.... 
+  0x0f, 0xb0, 0x00, 0x00,  //.@%.... 
+  0x0f, 0xb0, 0x00, 0x00,  //.@%.... 
+  0x0f, 0xb0, 0x00, 0x00,  //.@%.... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+
+
+  /*Unicode: U+0073 (s) , Width: 9 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x5c, 0xff, 0xd7, 0x00,  //..+@@@@+. 
+  0x07, 0xfc, 0x77, 0xaf, 0x90,  //.+@@++%@% 
+  0x0e, 0xd0, 0x00, 0x02, 0x30,  //.@@...... 
+  0x0f, 0xd0, 0x00, 0x00, 0x00,  //.@@...... 
+  0x09, 0xfb, 0x40, 0x00, 0x00,  //.%@%+.... 
+  0x00, 0x8e, 0xff, 0xc5, 0x00,  //..%@@@@+. 
+  0x00, 0x00, 0x26, 0xcf, 0x70,  //.....+@@+ 
+  0x00, 0x00, 0x00, 0x0d, 0xe0,  //.......@@ 
+  0x06, 0x00, 0x00, 0x0d, 0xe0,  //.+.....@@ 
+  0x2f, 0xe9, 0x77, 0xbf, 0x70,  //.@@%++%@+ 
+  0x03, 0x9d, 0xff, 0xc6, 0x00,  //..%@@@@+. 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+
+
+  /*Unicode: U+0074 (t) , Width: 7 */
+  0x00, 0x01, 0x00, 0x00,  //....... 
+  0x00, 0xdb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0xff, 0xff, 0xff, 0xf0,  //@@@@@@@ 
+  0x66, 0xfd, 0x66, 0x60,  //++@@+++ 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xfb, 0x00, 0x00,  //..@%... 
+  0x00, 0xee, 0x00, 0x00,  //..@@... 
+  0x00, 0x8f, 0xc7, 0x80,  //..%@@+% 
+  0x00, 0x08, 0xef, 0xd0,  //...%@@@ 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+  0x00, 0x00, 0x00, 0x00,  //....... 
+
+
+  /*Unicode: U+0075 (u) , Width: 9 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfb, 0x00, 0x00, 0x0b, 0xf0,  //@%.....%@ 
+  0xfc, 0x00, 0x00, 0x0e, 0xf0,  //@@.....@@ 
+  0xcf, 0x10, 0x00, 0x6f, 0xf0,  //@@....+@@ 
+  0x5f, 0xc5, 0x48, 0xed, 0xf0,  //+@@++%@@@ 
+  0x05, 0xdf, 0xea, 0x2b, 0xf0,  //.+@@@%.%@ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+
+
+  /*Unicode: U+0076 (v) , Width: 11 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x8f, 0x30, 0x00, 0x00, 0x0e, 0xb0,  //%@.......@% 
+  0x2f, 0xa0, 0x00, 0x00, 0x5f, 0x40,  //.@%.....+@+ 
+  0x0b, 0xf0, 0x00, 0x00, 0xcd, 0x00,  //.%@.....@@. 
+  0x04, 0xf6, 0x00, 0x02, 0xf7, 0x00,  //.+@+....@+. 
+  0x00, 0xed, 0x00, 0x08, 0xf1, 0x00,  //..@@...%@.. 
+  0x00, 0x7f, 0x30, 0x0e, 0xa0, 0x00,  //..+@...@%.. 
+  0x00, 0x1f, 0x90, 0x5f, 0x30, 0x00,  //...@%.+@... 
+  0x00, 0x0a, 0xf0, 0xbc, 0x00, 0x00,  //...%@.%@... 
+  0x00, 0x04, 0xf8, 0xf6, 0x00, 0x00,  //...+@%@+... 
+  0x00, 0x00, 0xdf, 0xe0, 0x00, 0x00,  //....@@@.... 
+  0x00, 0x00, 0x7f, 0x80, 0x00, 0x00,  //....+@%.... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0077 (w) , Width: 18 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x3f, 0x80, 0x00, 0x00, 0xcf, 0x10, 0x00, 0x02, 0xf7,  //.@%.....@@......@+ 
+  0x0e, 0xd0, 0x00, 0x01, 0xff, 0x60, 0x00, 0x08, 0xf2,  //.@@.....@@+....%@. 
+  0x08, 0xf2, 0x00, 0x07, 0xfe, 0xc0, 0x00, 0x0d, 0xc0,  //.%@....+@@@....@@. 
+  0x02, 0xf8, 0x00, 0x0c, 0xb8, 0xf1, 0x00, 0x3f, 0x60,  //..@%...@%%@....@+. 
+  0x00, 0xdd, 0x00, 0x2f, 0x62, 0xf7, 0x00, 0x8f, 0x10,  //..@@...@+.@+..%@.. 
+  0x00, 0x7f, 0x30, 0x7f, 0x00, 0xcc, 0x00, 0xdb, 0x00,  //..+@..+@..@@..@%.. 
+  0x00, 0x2f, 0x80, 0xda, 0x00, 0x7f, 0x23, 0xf5, 0x00,  //...@%.@%..+@..@+.. 
+  0x00, 0x0c, 0xd3, 0xf5, 0x00, 0x1f, 0x78, 0xf0, 0x00,  //...@@.@+...@+%@... 
+  0x00, 0x06, 0xfb, 0xf0, 0x00, 0x0b, 0xde, 0xa0, 0x00,  //...+@%@....%@@%... 
+  0x00, 0x01, 0xff, 0xa0, 0x00, 0x06, 0xff, 0x40, 0x00,  //....@@%....+@@+... 
+  0x00, 0x00, 0xbf, 0x40, 0x00, 0x00, 0xfe, 0x00, 0x00,  //....%@+.....@@.... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+
+
+  /*Unicode: U+0078 (x) , Width: 11 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x2f, 0xd0, 0x00, 0x00, 0xbf, 0x50,  //.@@.....%@+ 
+  0x05, 0xfa, 0x00, 0x07, 0xf9, 0x00,  //.+@%...+@%. 
+  0x00, 0x8f, 0x70, 0x3f, 0xc0, 0x00,  //..%@+..@@.. 
+  0x00, 0x0c, 0xf4, 0xee, 0x10, 0x00,  //...@@+@@... 
+  0x00, 0x01, 0xef, 0xf4, 0x00, 0x00,  //....@@@+... 
+  0x00, 0x00, 0x9f, 0xd0, 0x00, 0x00,  //....%@@.... 
+  0x00, 0x04, 0xfe, 0xf8, 0x00, 0x00,  //...+@@@%... 
+  0x00, 0x1e, 0xe1, 0xbf, 0x40, 0x00,  //...@@.%@+.. 
+  0x00, 0xcf, 0x30, 0x1e, 0xe2, 0x00,  //..@@...@@.. 
+  0x09, 0xf7, 0x00, 0x03, 0xfc, 0x00,  //.%@+....@@. 
+  0x5f, 0xa0, 0x00, 0x00, 0x7f, 0x90,  //+@%.....+@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+0079 (y) , Width: 11 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x8f, 0x40, 0x00, 0x00, 0x0e, 0xa0,  //%@+......@% 
+  0x1f, 0xa0, 0x00, 0x00, 0x6f, 0x40,  //.@%.....+@+ 
+  0x0a, 0xf1, 0x00, 0x00, 0xcd, 0x00,  //.%@.....@@. 
+  0x03, 0xf7, 0x00, 0x03, 0xf6, 0x00,  //..@+....@+. 
+  0x00, 0xce, 0x00, 0x0a, 0xe0, 0x00,  //..@@...%@.. 
+  0x00, 0x6f, 0x50, 0x1f, 0x80, 0x00,  //..+@+..@%.. 
+  0x00, 0x0e, 0xb0, 0x7f, 0x10, 0x00,  //...@%.+@... 
+  0x00, 0x08, 0xf2, 0xea, 0x00, 0x00,  //...%@.@%... 
+  0x00, 0x01, 0xfd, 0xf3, 0x00, 0x00,  //....@@@.... 
+  0x00, 0x00, 0xaf, 0xd0, 0x00, 0x00,  //....%@@.... 
+  0x00, 0x00, 0x6f, 0x60, 0x00, 0x00,  //....+@+.... 
+  0x00, 0x00, 0xce, 0x00, 0x00, 0x00,  //....@@..... 
+  0x00, 0x07, 0xf6, 0x00, 0x00, 0x00,  //...+@+..... 
+  0x05, 0xbf, 0x90, 0x00, 0x00, 0x00,  //.+%@%...... 
+  0x0f, 0xc5, 0x00, 0x00, 0x00, 0x00,  //.@@+....... 
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+007a (z) , Width: 9 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@ 
+  0x66, 0x66, 0x66, 0xaf, 0xc0,  //++++++%@@ 
+  0x00, 0x00, 0x01, 0xee, 0x10,  //......@@. 
+  0x00, 0x00, 0x0c, 0xf3, 0x00,  //.....@@.. 
+  0x00, 0x00, 0xaf, 0x50, 0x00,  //....%@+.. 
+  0x00, 0x07, 0xf8, 0x00, 0x00,  //...+@%... 
+  0x00, 0x5f, 0xb0, 0x00, 0x00,  //..+@%.... 
+  0x02, 0xfd, 0x00, 0x00, 0x00,  //..@@..... 
+  0x1e, 0xe2, 0x00, 0x00, 0x00,  //.@@...... 
+  0xcf, 0xa6, 0x66, 0x66, 0x60,  //@@%++++++ 
+  0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //......... 
+
+
+  /*Unicode: U+007b ({) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+007c (|) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+007d (}) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+007e (~) , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+};
+
+
+/*Store the glyph descriptions*/
+static const lv_font_glyph_dsc_t dejavu_20_glyph_dsc[] = 
+{
+  {.w_px = 6,	.glyph_index = 0},	/*Unicode: U+0020 ( )*/
+  {.w_px = 6,	.glyph_index = 60},	/*Unicode: U+0021 (!)*/
+  {.w_px = 6,	.glyph_index = 120},	/*Unicode: U+0022 (")*/
+  {.w_px = 6,	.glyph_index = 180},	/*Unicode: U+0023 (#)*/
+  {.w_px = 6,	.glyph_index = 240},	/*Unicode: U+0024 ($)*/
+  {.w_px = 6,	.glyph_index = 300},	/*Unicode: U+0025 (%)*/
+  {.w_px = 6,	.glyph_index = 360},	/*Unicode: U+0026 (&)*/
+  {.w_px = 6,	.glyph_index = 420},	/*Unicode: U+0027 (')*/
+  {.w_px = 6,	.glyph_index = 480},	/*Unicode: U+0028 (()*/
+  {.w_px = 6,	.glyph_index = 540},	/*Unicode: U+0029 ())*/
+  {.w_px = 6,	.glyph_index = 600},	/*Unicode: U+002a (*)*/
+  {.w_px = 6,	.glyph_index = 660},	/*Unicode: U+002b (+)*/
+  {.w_px = 6,	.glyph_index = 720},	/*Unicode: U+002c (,)*/
+  {.w_px = 6,	.glyph_index = 780},	/*Unicode: U+002d (-)*/
+  {.w_px = 2,	.glyph_index = 840},	/*Unicode: U+002e (.)*/
+  {.w_px = 6,	.glyph_index = 860},	/*Unicode: U+002f (/)*/
+  {.w_px = 11,	.glyph_index = 920},	/*Unicode: U+0030 (0)*/
+  {.w_px = 8,	.glyph_index = 1040},	/*Unicode: U+0031 (1)*/
+  {.w_px = 11,	.glyph_index = 1120},	/*Unicode: U+0032 (2)*/
+  {.w_px = 10,	.glyph_index = 1240},	/*Unicode: U+0033 (3)*/
+  {.w_px = 11,	.glyph_index = 1340},	/*Unicode: U+0034 (4)*/
+  {.w_px = 11,	.glyph_index = 1460},	/*Unicode: U+0035 (5)*/
+  {.w_px = 11,	.glyph_index = 1580},	/*Unicode: U+0036 (6)*/
+  {.w_px = 10,	.glyph_index = 1700},	/*Unicode: U+0037 (7)*/
+  {.w_px = 11,	.glyph_index = 1800},	/*Unicode: U+0038 (8)*/
+  {.w_px = 11,	.glyph_index = 1920},	/*Unicode: U+0039 (9)*/
+  {.w_px = 6,	.glyph_index = 2040},	/*Unicode: U+003a (:)*/
+  {.w_px = 6,	.glyph_index = 2100},	/*Unicode: U+003b (;)*/
+  {.w_px = 6,	.glyph_index = 2160},	/*Unicode: U+003c (<)*/
+  {.w_px = 6,	.glyph_index = 2220},	/*Unicode: U+003d (=)*/
+  {.w_px = 6,	.glyph_index = 2280},	/*Unicode: U+003e (>)*/
+  {.w_px = 6,	.glyph_index = 2340},	/*Unicode: U+003f (?)*/
+  {.w_px = 6,	.glyph_index = 2400},	/*Unicode: U+0040 (@)*/
+  {.w_px = 15,	.glyph_index = 2460},	/*Unicode: U+0041 (A)*/
+  {.w_px = 11,	.glyph_index = 2620},	/*Unicode: U+0042 (B)*/
+  {.w_px = 12,	.glyph_index = 2740},	/*Unicode: U+0043 (C)*/
+  {.w_px = 13,	.glyph_index = 2860},	/*Unicode: U+0044 (D)*/
+  {.w_px = 10,	.glyph_index = 3000},	/*Unicode: U+0045 (E)*/
+  {.w_px = 10,	.glyph_index = 3100},	/*Unicode: U+0046 (F)*/
+  {.w_px = 13,	.glyph_index = 3200},	/*Unicode: U+0047 (G)*/
+  {.w_px = 13,	.glyph_index = 3340},	/*Unicode: U+0048 (H)*/
+  {.w_px = 2,	.glyph_index = 3480},	/*Unicode: U+0049 (I)*/
+  {.w_px = 5,	.glyph_index = 3500},	/*Unicode: U+004a (J)*/
+  {.w_px = 12,	.glyph_index = 3560},	/*Unicode: U+004b (K)*/
+  {.w_px = 10,	.glyph_index = 3680},	/*Unicode: U+004c (L)*/
+  {.w_px = 14,	.glyph_index = 3780},	/*Unicode: U+004d (M)*/
+  {.w_px = 12,	.glyph_index = 3920},	/*Unicode: U+004e (N)*/
+  {.w_px = 14,	.glyph_index = 4040},	/*Unicode: U+004f (O)*/
+  {.w_px = 11,	.glyph_index = 4180},	/*Unicode: U+0050 (P)*/
+  {.w_px = 14,	.glyph_index = 4300},	/*Unicode: U+0051 (Q)*/
+  {.w_px = 12,	.glyph_index = 4440},	/*Unicode: U+0052 (R)*/
+  {.w_px = 12,	.glyph_index = 4560},	/*Unicode: U+0053 (S)*/
+  {.w_px = 12,	.glyph_index = 4680},	/*Unicode: U+0054 (T)*/
+  {.w_px = 12,	.glyph_index = 4800},	/*Unicode: U+0055 (U)*/
+  {.w_px = 15,	.glyph_index = 4920},	/*Unicode: U+0056 (V)*/
+  {.w_px = 23,	.glyph_index = 5080},	/*Unicode: U+0057 (W)*/
+  {.w_px = 14,	.glyph_index = 5320},	/*Unicode: U+0058 (X)*/
+  {.w_px = 13,	.glyph_index = 5460},	/*Unicode: U+0059 (Y)*/
+  {.w_px = 11,	.glyph_index = 5600},	/*Unicode: U+005a (Z)*/
+  {.w_px = 6,	.glyph_index = 5720},	/*Unicode: U+005b ([)*/
+  {.w_px = 6,	.glyph_index = 5780},	/*Unicode: U+005c (\)*/
+  {.w_px = 6,	.glyph_index = 5840},	/*Unicode: U+005d (])*/
+  {.w_px = 6,	.glyph_index = 5900},	/*Unicode: U+005e (^)*/
+  {.w_px = 6,	.glyph_index = 5960},	/*Unicode: U+005f (_)*/
+  {.w_px = 6,	.glyph_index = 6020},	/*Unicode: U+0060 (`)*/
+  {.w_px = 10,	.glyph_index = 6080},	/*Unicode: U+0061 (a)*/
+  {.w_px = 10,	.glyph_index = 6180},	/*Unicode: U+0062 (b)*/
+  {.w_px = 9,	.glyph_index = 6280},	/*Unicode: U+0063 (c)*/
+  {.w_px = 10,	.glyph_index = 6380},	/*Unicode: U+0064 (d)*/
+  {.w_px = 10,	.glyph_index = 6480},	/*Unicode: U+0065 (e)*/
+  {.w_px = 7,	.glyph_index = 6580},	/*Unicode: U+0066 (f)*/
+  {.w_px = 10,	.glyph_index = 6660},	/*Unicode: U+0067 (g)*/
+  {.w_px = 9,	.glyph_index = 6760},	/*Unicode: U+0068 (h)*/
+  {.w_px = 2,	.glyph_index = 6860},	/*Unicode: U+0069 (i)*/
+  {.w_px = 3,	.glyph_index = 6880},	/*Unicode: U+006a (j)*/
+  {.w_px = 10,	.glyph_index = 6920},	/*Unicode: U+006b (k)*/
+  {.w_px = 2,	.glyph_index = 7020},	/*Unicode: U+006c (l)*/
+  {.w_px = 17,	.glyph_index = 7040},	/*Unicode: U+006d (m)*/
+  {.w_px = 10,	.glyph_index = 7220},	/*Unicode: U+006e (n)*/
+  {.w_px = 10,	.glyph_index = 7320},	/*Unicode: U+006f (o)*/
+  {.w_px = 11,	.glyph_index = 7420},	/*Unicode: U+0070 (p)*/
+  {.w_px = 11,	.glyph_index = 7540},	/*Unicode: U+0071 (q)*/
+  {.w_px = 7,	.glyph_index = 7660},	/*Unicode: U+0072 (r)*/
+  {.w_px = 9,	.glyph_index = 7740},	/*Unicode: U+0073 (s)*/
+  {.w_px = 7,	.glyph_index = 7840},	/*Unicode: U+0074 (t)*/
+  {.w_px = 9,	.glyph_index = 7920},	/*Unicode: U+0075 (u)*/
+  {.w_px = 11,	.glyph_index = 8020},	/*Unicode: U+0076 (v)*/
+  {.w_px = 18,	.glyph_index = 8140},	/*Unicode: U+0077 (w)*/
+  {.w_px = 11,	.glyph_index = 8320},	/*Unicode: U+0078 (x)*/
+  {.w_px = 11,	.glyph_index = 8440},	/*Unicode: U+0079 (y)*/
+  {.w_px = 9,	.glyph_index = 8560},	/*Unicode: U+007a (z)*/
+  {.w_px = 6,	.glyph_index = 8660},	/*Unicode: U+007b ({)*/
+  {.w_px = 6,	.glyph_index = 8720},	/*Unicode: U+007c (|)*/
+  {.w_px = 6,	.glyph_index = 8780},	/*Unicode: U+007d (})*/
+  {.w_px = 6,	.glyph_index = 8840},	/*Unicode: U+007e (~)*/
+};
+
+lv_font_t dejavu_20 = 
+{
+    .unicode_first = 32,	/*First Unicode letter in this font*/
+    .unicode_last = 126,	/*Last Unicode letter in this font*/
+    .h_px = 20,				/*Font height in pixels*/
+    .glyph_bitmap = dejavu_20_glyph_bitmap,	/*Bitmap of glyphs*/
+    .glyph_dsc = dejavu_20_glyph_dsc,		/*Description of glyphs*/
+    .glyph_cnt = 95,			/*Number of glyphs in the font*/
+    .unicode_list = NULL,	/*Every character in the font from 'unicode_first' to 'unicode_last'*/
+    .get_bitmap = lv_font_get_bitmap_continuous,	/*Function pointer to get glyph's bitmap*/
+    .get_width = lv_font_get_width_continuous,	/*Function pointer to get glyph's width*/
+    .bpp = 4,				/*Bit per pixel*/
+    .monospace = 0,				/*Fix width (0: if not used)*/
+    .next_page = NULL,		/*Pointer to a font extension*/
+};
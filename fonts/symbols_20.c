@@ -0,0 +1,1289 @@
+
+#include "../../../include/display/lvgl.h"
+
+/***********************************************************************************
+ * FontAwesome5-Solid+Brands+Regular.woff 20 px Font in U+f000 () .. U+f2ee ()  range with 4 bpp
+ * Sparse font with only these characters: 
+***********************************************************************************/
+
+/*Store the image of the letters (glyph)*/
+static const uint8_t symbols_20_glyph_bitmap[] = 
+{
+  /*Unicode: U+f001 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6b, 0xfa,  //................+%@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xdf, 0xff, 0xff,  //.............%@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x15, 0xae, 0xff, 0xff, 0xff, 0xff,  //.........+%@@@@@@@@@ 
+  0x00, 0x00, 0x01, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //......+@@@@@@@@@@@@@ 
+  0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //.....@@@@@@@@@@@@@@@ 
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x38, 0xff,  //.....@@@@@@@@@@%.%@@ 
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xfa, 0x61, 0x00, 0x07, 0xff,  //.....@@@@@@%+....+@@ 
+  0x00, 0x00, 0x0f, 0xfe, 0x94, 0x00, 0x00, 0x00, 0x07, 0xff,  //.....@@@%+.......+@@ 
+  0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,  //.....@@+.........+@@ 
+  0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,  //.....@@+.........+@@ 
+  0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,  //.....@@+.........+@@ 
+  0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,  //.....@@+.........+@@ 
+  0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x03, 0xbe, 0xfe, 0xff,  //.....@@+......%@@@@@ 
+  0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff,  //.....@@+.....@@@@@@@ 
+  0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,  //.....@@+....+@@@@@@@ 
+  0x07, 0xdf, 0xff, 0xf7, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xfd,  //.+@@@@@+.....@@@@@@@ 
+  0xaf, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x03, 0xbe, 0xfe, 0x91,  //%@@@@@@+......%@@@%. 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+............ 
+  0xaf, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //%@@@@@@............. 
+  0x07, 0xdf, 0xeb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.+@@@%.............. 
+
+
+  /*Unicode: U+f008 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0xc3, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3c,  //@..%@@@@@@@@@@@@...@ 
+  0xff, 0xff, 0xff, 0xed, 0xdd, 0xdd, 0xde, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xf5, 0x23, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xef, 0x32, 0x5f,  //@+..@@........@@..+@ 
+  0xf2, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x2f,  //@...@@........@@...@ 
+  0xf3, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x3f,  //@...@@........@@...@ 
+  0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xff,  //@@@@@@........@@@@@@ 
+  0xf5, 0x29, 0xff, 0xed, 0xdd, 0xdd, 0xde, 0xff, 0x32, 0x5f,  //@+.%@@@@@@@@@@@@..+@ 
+  0xf2, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x2f,  //@..+@@@@@@@@@@@@...@ 
+  0xf5, 0x29, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xef, 0x32, 0x5f,  //@+.%@@........@@..+@ 
+  0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xff,  //@@@@@@........@@@@@@ 
+  0xf3, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x3f,  //@...@@........@@...@ 
+  0xf2, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x2f,  //@...@@........@@...@ 
+  0xf5, 0x23, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xef, 0x32, 0x5f,  //@+..@@........@@..+@ 
+  0xff, 0xff, 0xff, 0xed, 0xdd, 0xdd, 0xde, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xd3, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3c,  //@..%@@@@@@@@@@@@...@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f00b () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0xcf, 0xff, 0xf9, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@%.%@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xcf, 0xff, 0xf9, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@%.%@@@@@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0xcf, 0xff, 0xf9, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@%.%@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xcf, 0xff, 0xf9, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@%.%@@@@@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0xcf, 0xff, 0xf9, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@%.%@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xfd, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@.@@@@@@@@@@@@@ 
+  0xcf, 0xff, 0xf9, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,  //@@@@@%.%@@@@@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f00c () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0x60,  //................+@+. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xf7,  //...............+@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff,  //..............+@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6,  //.............+@@@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x60,  //............+@@@@@+. 
+  0x06, 0xe4, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xf6, 0x00,  //.+@+.......+@@@@@+.. 
+  0x7f, 0xff, 0x40, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x60, 0x00,  //+@@@+.....+@@@@@+... 
+  0xff, 0xff, 0xf4, 0x00, 0x04, 0xff, 0xff, 0xf6, 0x00, 0x00,  //@@@@@+...+@@@@@+.... 
+  0x6f, 0xff, 0xff, 0x40, 0x4f, 0xff, 0xff, 0x50, 0x00, 0x00,  //+@@@@@+.+@@@@@+..... 
+  0x06, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00,  //.+@@@@@%@@@@@+...... 
+  0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00,  //..+@@@@@@@@@+....... 
+  0x00, 0x05, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,  //...+@@@@@@@+........ 
+  0x00, 0x00, 0x5f, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,  //....+@@@@@+......... 
+  0x00, 0x00, 0x05, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,  //.....+@@@+.......... 
+  0x00, 0x00, 0x00, 0x5e, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,  //......+@+........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f00d () , Width: 14 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x08, 0xa1, 0x00, 0x00, 0x00, 0x2b, 0x60,  //.%%........%+. 
+  0xaf, 0xfc, 0x10, 0x00, 0x03, 0xef, 0xf6,  //%@@@......@@@+ 
+  0xef, 0xff, 0xc1, 0x00, 0x3e, 0xff, 0xfb,  //@@@@@....@@@@% 
+  0x5f, 0xff, 0xfc, 0x13, 0xef, 0xff, 0xe2,  //+@@@@@..@@@@@. 
+  0x05, 0xff, 0xff, 0xde, 0xff, 0xfe, 0x30,  //.+@@@@@@@@@@.. 
+  0x00, 0x5f, 0xff, 0xff, 0xff, 0xe3, 0x00,  //..+@@@@@@@@... 
+  0x00, 0x05, 0xff, 0xff, 0xfe, 0x30, 0x00,  //...+@@@@@@.... 
+  0x00, 0x02, 0xef, 0xff, 0xfd, 0x10, 0x00,  //....@@@@@@.... 
+  0x00, 0x2e, 0xff, 0xff, 0xff, 0xc1, 0x00,  //...@@@@@@@@... 
+  0x02, 0xef, 0xff, 0xef, 0xff, 0xfc, 0x10,  //..@@@@@@@@@@.. 
+  0x2e, 0xff, 0xfe, 0x25, 0xff, 0xff, 0xc1,  //.@@@@@.+@@@@@. 
+  0xef, 0xff, 0xe2, 0x00, 0x5f, 0xff, 0xfa,  //@@@@@...+@@@@% 
+  0xcf, 0xfe, 0x20, 0x00, 0x05, 0xff, 0xf8,  //@@@@.....+@@@% 
+  0x1c, 0xe2, 0x00, 0x00, 0x00, 0x5e, 0xa0,  //.@@.......+@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.............. 
+
+
+  /*Unicode: U+f011 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0xef, 0xf1, 0x00, 0x00, 0x00, 0x00,  //........@@@......... 
+  0x00, 0x01, 0x82, 0x00, 0xff, 0xf1, 0x01, 0x82, 0x00, 0x00,  //....%...@@@...%..... 
+  0x00, 0x2e, 0xfc, 0x00, 0xff, 0xf1, 0x0a, 0xff, 0x30, 0x00,  //...@@@..@@@..%@@.... 
+  0x01, 0xdf, 0xff, 0x10, 0xff, 0xf1, 0x0f, 0xff, 0xe2, 0x00,  //..@@@@..@@@..@@@@... 
+  0x09, 0xff, 0xf6, 0x00, 0xff, 0xf1, 0x04, 0xff, 0xfb, 0x00,  //.%@@@+..@@@..+@@@%.. 
+  0x2f, 0xff, 0x70, 0x00, 0xff, 0xf1, 0x00, 0x5f, 0xff, 0x40,  //.@@@+...@@@...+@@@+. 
+  0x8f, 0xfd, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x0b, 0xff, 0xa0,  //%@@@....@@@....%@@%. 
+  0xcf, 0xf6, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x04, 0xff, 0xe0,  //@@@+....@@@....+@@@. 
+  0xff, 0xf3, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x01, 0xff, 0xf0,  //@@@.....@@@.....@@@. 
+  0xff, 0xf2, 0x00, 0x00, 0xff, 0xf1, 0x00, 0x00, 0xff, 0xf1,  //@@@.....@@@.....@@@. 
+  0xef, 0xf3, 0x00, 0x00, 0xcf, 0xe0, 0x00, 0x01, 0xff, 0xf0,  //@@@.....@@@.....@@@. 
+  0xcf, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xe0,  //@@@+...........+@@@. 
+  0x8f, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xa0,  //%@@@...........@@@%. 
+  0x2f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0x40,  //.@@@%.........+@@@+. 
+  0x09, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x06, 0xff, 0xfb, 0x00,  //.%@@@%.......+@@@%.. 
+  0x00, 0xdf, 0xff, 0xc5, 0x10, 0x14, 0xbf, 0xff, 0xe1, 0x00,  //..@@@@@+...+%@@@@... 
+  0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00,  //...@@@@@@@@@@@@@.... 
+  0x00, 0x01, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x00,  //....%@@@@@@@@@%..... 
+  0x00, 0x00, 0x03, 0x9e, 0xff, 0xfe, 0xa4, 0x00, 0x00, 0x00,  //......%@@@@@%+...... 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f013 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xe0, 0x00, 0x00, 0x00,  //........@@@@@....... 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,  //........@@@@@....... 
+  0x00, 0x01, 0x00, 0x06, 0xff, 0xff, 0xf5, 0x00, 0x01, 0x00,  //.......+@@@@@+...... 
+  0x00, 0x7f, 0xa6, 0xef, 0xff, 0xff, 0xff, 0xc5, 0xde, 0x20,  //..+@%+@@@@@@@@@+@@.. 
+  0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@@@@@@@. 
+  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,  //.%@@@@@@@@@@@@@@@@@+ 
+  0x1f, 0xff, 0xff, 0xff, 0xd7, 0x69, 0xff, 0xff, 0xff, 0xfa,  //.@@@@@@@@++%@@@@@@@% 
+  0x06, 0xef, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xc2,  //.+@@@@@@.....@@@@@@. 
+  0x00, 0x4f, 0xff, 0xf3, 0x00, 0x00, 0x09, 0xff, 0xfe, 0x00,  //..+@@@@......%@@@@.. 
+  0x00, 0x5f, 0xff, 0xf0, 0x00, 0x00, 0x06, 0xff, 0xff, 0x00,  //..+@@@@......+@@@@.. 
+  0x00, 0x5f, 0xff, 0xf3, 0x00, 0x00, 0x09, 0xff, 0xfe, 0x00,  //..+@@@@......%@@@@.. 
+  0x06, 0xef, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xc2,  //.+@@@@@@.....@@@@@@. 
+  0x1f, 0xff, 0xff, 0xff, 0xd7, 0x69, 0xff, 0xff, 0xff, 0xfa,  //.@@@@@@@@++%@@@@@@@% 
+  0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,  //.%@@@@@@@@@@@@@@@@@+ 
+  0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //..@@@@@@@@@@@@@@@@@. 
+  0x00, 0x7f, 0xa6, 0xef, 0xff, 0xff, 0xff, 0xc5, 0xde, 0x20,  //..+@%+@@@@@@@@@+@@.. 
+  0x00, 0x01, 0x00, 0x05, 0xff, 0xff, 0xf5, 0x00, 0x01, 0x00,  //.......+@@@@@+...... 
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,  //........@@@@@....... 
+  0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xe0, 0x00, 0x00, 0x00,  //........@@@@@....... 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f014 () , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+f015 () , Width: 23 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x70, 0x00, 0x00,  //................+++.... 
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xcf, 0x80, 0x00, 0xff, 0xf0, 0x00, 0x00,  //..........@@%...@@@.... 
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xfb, 0x10, 0xff, 0xf0, 0x00, 0x00,  //........+@@@@%..@@@.... 
+  0x00, 0x00, 0x00, 0x09, 0xff, 0xfe, 0xff, 0xd4, 0xff, 0xf0, 0x00, 0x00,  //.......%@@@@@@@+@@@.... 
+  0x00, 0x00, 0x01, 0xcf, 0xfe, 0x40, 0xaf, 0xff, 0xff, 0xf0, 0x00, 0x00,  //......@@@@+.%@@@@@@.... 
+  0x00, 0x00, 0x3e, 0xff, 0xc1, 0x7e, 0x36, 0xff, 0xff, 0xf0, 0x00, 0x00,  //.....@@@@.+@.+@@@@@.... 
+  0x00, 0x07, 0xff, 0xf9, 0x0a, 0xff, 0xf5, 0x3e, 0xff, 0xf4, 0x00, 0x00,  //...+@@@%.%@@@+.@@@@+... 
+  0x00, 0xaf, 0xff, 0x51, 0xcf, 0xff, 0xff, 0x71, 0xbf, 0xff, 0x60, 0x00,  //..%@@@+.@@@@@@+.%@@@+.. 
+  0x2d, 0xff, 0xd2, 0x2d, 0xff, 0xff, 0xff, 0xfa, 0x08, 0xff, 0xf9, 0x00,  //.@@@@..@@@@@@@@%.%@@@%. 
+  0xef, 0xfb, 0x04, 0xef, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x4e, 0xff, 0x60,  //@@@%.+@@@@@@@@@@@.+@@@+ 
+  0x5f, 0x70, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x22, 0xdc, 0x00,  //+@+.+@@@@@@@@@@@@@..@@. 
+  0x01, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00,  //....@@@@@@@@@@@@@@%.... 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00,  //....@@@@@@@@@@@@@@%.... 
+  0x00, 0x00, 0xff, 0xff, 0xfb, 0x00, 0x1f, 0xff, 0xff, 0x90, 0x00, 0x00,  //....@@@@@%...@@@@@%.... 
+  0x00, 0x00, 0xff, 0xff, 0xf9, 0x00, 0x0f, 0xff, 0xff, 0x90, 0x00, 0x00,  //....@@@@@%...@@@@@%.... 
+  0x00, 0x00, 0xff, 0xff, 0xf9, 0x00, 0x0f, 0xff, 0xff, 0x90, 0x00, 0x00,  //....@@@@@%...@@@@@%.... 
+  0x00, 0x00, 0xff, 0xff, 0xf9, 0x00, 0x0f, 0xff, 0xff, 0x90, 0x00, 0x00,  //....@@@@@%...@@@@@%.... 
+  0x00, 0x00, 0xef, 0xff, 0xf8, 0x00, 0x0e, 0xff, 0xff, 0x80, 0x00, 0x00,  //....@@@@@%...@@@@@%.... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+
+
+  /*Unicode: U+f019 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x0c, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x1c, 0xdd, 0xdf, 0xff, 0xff, 0xdd, 0xdc, 0x10, 0x00,  //...@@@@@@@@@@@@@.... 
+  0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x00,  //...@@@@@@@@@@@@@.... 
+  0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00,  //....@@@@@@@@@@@..... 
+  0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00,  //.....@@@@@@@@@...... 
+  0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......@@@@@@@....... 
+  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x69, 0x99, 0x99, 0x54, 0xff, 0xf4, 0x29, 0x99, 0x99, 0x96,  //+%%%%%++@@@+.%%%%%%+ 
+  0xff, 0xff, 0xff, 0xfa, 0x5e, 0x45, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@%+@++@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xeb, 0xcf, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@%@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2f, 0x38, 0xff,  //@@@@@@@@@@@@@%.@.%@@ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,  //@@@@@@@@@@@@@@@@@@@@ 
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,  //.................... 
+
+
+  /*Unicode: U+f01c () , Width: 23 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00,  //.....@@@@@@@@@@@@%..... 
+  0x00, 0x01, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //....@@@@@@@@@@@@@@+.... 
+  0x00, 0x0a, 0xff, 0x97, 0x77, 0x77, 0x77, 0x77, 0xdf, 0xf2, 0x00, 0x00,  //...%@@%+++++++++@@@.... 
+  0x00, 0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xfc, 0x00, 0x00,  //..+@@%...........@@@... 
+  0x01, 0xef, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x70, 0x00,  //..@@@............+@@+.. 
+  0x0a, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf2, 0x00,  //.%@@+.............@@@.. 
+  0x5f, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xfc, 0x00,  //+@@%...............@@@. 
+  0xdf, 0xf9, 0x77, 0x77, 0x00, 0x00, 0x00, 0x37, 0x77, 0x7d, 0xff, 0x50,  //@@@%++++.......++++@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@+.....@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@....+@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00,  //+@@@@@@@@@@@@@@@@@@@@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+
+
+  /*Unicode: U+f021 () , Width: 20 */
+  0x00, 0x00, 0x01, 0x7b, 0xef, 0xfc, 0x82, 0x00, 0x0e, 0xff,  //......+%@@@@%....@@@ 
+  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x0d, 0xff,  //....+@@@@@@@@@%..@@@ 
+  0x00, 0x0b, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0x6c, 0xff,  //...%@@@@@@@@@@@@+@@@ 
+  0x00, 0xbf, 0xff, 0xb4, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff,  //..%@@@%+....+@@@@@@@ 
+  0x08, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff,  //.%@@@+........+@@@@@ 
+  0x1f, 0xff, 0x50, 0x00, 0x00, 0x0c, 0xed, 0xde, 0xff, 0xff,  //.@@@+......@@@@@@@@@ 
+  0x6f, 0xfa, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff,  //+@@%.......@@@@@@@@@ 
+  0x9f, 0xf3, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xff,  //%@@........@@@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x3f, 0xf9,  //@@@@@@@@@........@@% 
+  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0xaf, 0xf5,  //@@@@@@@@@.......%@@+ 
+  0xff, 0xff, 0xec, 0xde, 0xc0, 0x00, 0x00, 0x05, 0xff, 0xf0,  //@@@@@@@@@......+@@@. 
+  0xff, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0x70,  //@@@@@+........+@@@+. 
+  0xff, 0xff, 0xff, 0xc5, 0x00, 0x00, 0x4c, 0xff, 0xfb, 0x00,  //@@@@@@@+....+@@@@%.. 
+  0xff, 0xc6, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xb0, 0x00,  //@@@+@@@@@@@@@@@@%... 
+  0xff, 0xd0, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,  //@@@..%@@@@@@@@@+.... 
+  0xff, 0xe0, 0x00, 0x28, 0xcf, 0xfe, 0xb6, 0x10, 0x00, 0x00,  //@@@....%@@@@%+...... 
+  0xde, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@%................. 
+
+
+  /*Unicode: U+f026 () , Width: 10 */
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x11,  //.......... 
+  0x00, 0x00, 0x00, 0x02, 0xee,  //........@@ 
+  0x00, 0x00, 0x00, 0x2e, 0xff,  //.......@@@ 
+  0x00, 0x00, 0x02, 0xef, 0xff,  //......@@@@ 
+  0x57, 0x77, 0x7e, 0xff, 0xff,  //+++++@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0xcf, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@ 
+  0x00, 0x00, 0x09, 0xff, 0xff,  //.....%@@@@ 
+  0x00, 0x00, 0x00, 0x9f, 0xff,  //......%@@@ 
+  0x00, 0x00, 0x00, 0x08, 0xff,  //.......%@@ 
+  0x00, 0x00, 0x00, 0x00, 0x78,  //........+% 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00,  //.......... 
+
+
+  /*Unicode: U+f027 () , Width: 15 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,  //........+%..... 
+  0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x00,  //.......%@@..... 
+  0x00, 0x00, 0x00, 0x9f, 0xff, 0x00, 0x00, 0x00,  //......%@@@..... 
+  0x00, 0x00, 0x09, 0xff, 0xff, 0x00, 0x00, 0x00,  //.....%@@@@..... 
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0x00, 0x73, 0x00,  //@@@@@@@@@@..+.. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x40,  //@@@@@@@@@@..@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x5f, 0xc0,  //@@@@@@@@@@..+@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0e, 0xf0,  //@@@@@@@@@@...@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x4f, 0xd0,  //@@@@@@@@@@..+@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x50,  //@@@@@@@@@@..@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x85, 0x00,  //@@@@@@@@@@..%+. 
+  0x57, 0x77, 0x7e, 0xff, 0xff, 0x00, 0x00, 0x00,  //+++++@@@@@..... 
+  0x00, 0x00, 0x02, 0xef, 0xff, 0x00, 0x00, 0x00,  //......@@@@..... 
+  0x00, 0x00, 0x00, 0x2e, 0xff, 0x00, 0x00, 0x00,  //.......@@@..... 
+  0x00, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00, 0x00,  //........@@..... 
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............... 
+
+
+  /*Unicode: U+f028 () , Width: 23 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x40, 0x00, 0x00,  //................+@+.... 
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x6f, 0xf6, 0x00, 0x00,  //................+@@+... 
+  0x00, 0x00, 0x00, 0x02, 0xee, 0x00, 0x00, 0x00, 0x05, 0xff, 0x50, 0x00,  //........@@.......+@@+.. 
+  0x00, 0x00, 0x00, 0x2e, 0xff, 0x00, 0x00, 0x78, 0x00, 0x4f, 0xf1, 0x00,  //.......@@@....+%..+@@.. 
+  0x00, 0x00, 0x02, 0xef, 0xff, 0x00, 0x00, 0xcf, 0xc0, 0x08, 0xfa, 0x00,  //......@@@@....@@@..%@%. 
+  0x57, 0x77, 0x7e, 0xff, 0xff, 0x00, 0x00, 0x1c, 0xfa, 0x00, 0xef, 0x10,  //+++++@@@@@.....@@%..@@. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x84, 0x00, 0xef, 0x30, 0x8f, 0x70,  //@@@@@@@@@@..%+..@@..%@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x40, 0x6f, 0x90, 0x3f, 0xa0,  //@@@@@@@@@@..@@+.+@%..@% 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x4f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0,  //@@@@@@@@@@..+@@..@@..@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0e, 0xf0, 0x0f, 0xd0, 0x0f, 0xd0,  //@@@@@@@@@@...@@..@@..@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x4f, 0xc0, 0x1f, 0xc0, 0x1f, 0xc0,  //@@@@@@@@@@..+@@..@@..@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x40, 0x6f, 0x90, 0x3f, 0xa0,  //@@@@@@@@@@..@@+.+@%..@% 
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0x00, 0x84, 0x00, 0xef, 0x30, 0x8f, 0x60,  //@@@@@@@@@@..%+..@@..%@+ 
+  0x00, 0x00, 0x09, 0xff, 0xff, 0x00, 0x00, 0x1c, 0xfa, 0x00, 0xef, 0x10,  //.....%@@@@.....@@%..@@. 
+  0x00, 0x00, 0x00, 0x9f, 0xff, 0x00, 0x00, 0xcf, 0xc0, 0x08, 0xfa, 0x00,  //......%@@@....@@@..%@%. 
+  0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0x00, 0x78, 0x00, 0x4f, 0xf1, 0x00,  //.......%@@....+%..+@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x05, 0xff, 0x50, 0x00,  //........+%.......+@@+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf6, 0x00, 0x00,  //................+@@+... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x40, 0x00, 0x00,  //................+@+.... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+
+
+  /*Unicode: U+f03e () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,  //+@@@@@@@@@@@@@@@@@@+ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xe5, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@+.%@@@@@@@@@@@@@@ 
+  0xff, 0x50, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@+...%@@@@@@@@@@@@@ 
+  0xff, 0x20, 0x00, 0x7f, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xff,  //@@....+@@@@@@%@@@@@@ 
+  0xff, 0x80, 0x00, 0xcf, 0xff, 0xff, 0x90, 0x3e, 0xff, 0xff,  //@@%...@@@@@@%..@@@@@ 
+  0xff, 0xfa, 0x7c, 0xff, 0xff, 0xf9, 0x00, 0x03, 0xef, 0xff,  //@@@%+@@@@@@%....@@@@ 
+  0xff, 0xff, 0xfc, 0xff, 0xff, 0x90, 0x00, 0x00, 0x3e, 0xff,  //@@@@@@@@@@%......@@@ 
+  0xff, 0xff, 0x90, 0x6f, 0xf9, 0x00, 0x00, 0x00, 0x08, 0xff,  //@@@@%.+@@%.......%@@ 
+  0xff, 0xf9, 0x00, 0x06, 0x90, 0x00, 0x00, 0x00, 0x07, 0xff,  //@@@%...+%........+@@ 
+  0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,  //@@%..............+@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,  //@@+..............+@@ 
+  0xff, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7b, 0xff,  //@@%++++++++++++++%@@ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@ 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,  //+@@@@@@@@@@@@@@@@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f040 () , Width: 6 */
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+  0x00, 0x00, 0x00,  //...... 
+
+
+  /*Unicode: U+f048 () , Width: 13 */
+  0x57, 0x70, 0x00, 0x00, 0x00, 0x27, 0x10,  //+++........+. 
+  0xdf, 0xf0, 0x00, 0x00, 0x03, 0xef, 0x90,  //@@@.......@@% 
+  0xdf, 0xf0, 0x00, 0x00, 0x4f, 0xff, 0xa0,  //@@@.....+@@@% 
+  0xdf, 0xf0, 0x00, 0x05, 0xff, 0xff, 0xa0,  //@@@....+@@@@% 
+  0xdf, 0xf0, 0x00, 0x6f, 0xff, 0xff, 0xa0,  //@@@...+@@@@@% 
+  0xdf, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xa0,  //@@@..+@@@@@@% 
+  0xdf, 0xf0, 0x8f, 0xff, 0xff, 0xff, 0xa0,  //@@@.%@@@@@@@% 
+  0xdf, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xa0,  //@@@%@@@@@@@@% 
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //@@@@@@@@@@@@% 
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //@@@@@@@@@@@@% 
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //@@@@@@@@@@@@% 
+  0xdf, 0xf3, 0xef, 0xff, 0xff, 0xff, 0xa0,  //@@@.@@@@@@@@% 
+  0xdf, 0xf0, 0x2e, 0xff, 0xff, 0xff, 0xa0,  //@@@..@@@@@@@% 
+  0xdf, 0xf0, 0x01, 0xdf, 0xff, 0xff, 0xa0,  //@@@...@@@@@@% 
+  0xdf, 0xf0, 0x00, 0x1c, 0xff, 0xff, 0xa0,  //@@@....@@@@@% 
+  0xdf, 0xf0, 0x00, 0x00, 0xbf, 0xff, 0xa0,  //@@@.....%@@@% 
+  0xdf, 0xf0, 0x00, 0x00, 0x0a, 0xff, 0xa0,  //@@@......%@@% 
+  0xcf, 0xf0, 0x00, 0x00, 0x00, 0x9f, 0x60,  //@@@.......%@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+
+
+  /*Unicode: U+f04b () , Width: 18 */
+  0xcf, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@.............. 
+  0xff, 0xff, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@%............ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+.......... 
+  0xff, 0xff, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@+........ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x00,  //@@@@@@@@@@%....... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,  //@@@@@@@@@@@@%..... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x00,  //@@@@@@@@@@@@@@+... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,  //@@@@@@@@@@@@@@@%.. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,  //@@@@@@@@@@@@@@@@@. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,  //@@@@@@@@@@@@@@@@@. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20,  //@@@@@@@@@@@@@@@%.. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x00,  //@@@@@@@@@@@@@@+... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //@@@@@@@@@@@@+..... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x00, 0x00, 0x00,  //@@@@@@@@@@%....... 
+  0xff, 0xff, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@+........ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@+.......... 
+  0xff, 0xff, 0xfa, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@%............ 
+  0xcf, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@.............. 
+  0x06, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.++............... 
+
+
+  /*Unicode: U+f04c () , Width: 18 */
+  0x17, 0x88, 0x88, 0x40, 0x00, 0x17, 0x88, 0x88, 0x40,  //.+%%%%+....+%%%%+. 
+  0xcf, 0xff, 0xff, 0xf4, 0x00, 0xcf, 0xff, 0xff, 0xf4,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xf7, 0x00, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..@@@@@@@+ 
+  0xef, 0xff, 0xff, 0xf6, 0x00, 0xef, 0xff, 0xff, 0xf6,  //@@@@@@@+..@@@@@@@+ 
+  0x5e, 0xff, 0xff, 0xb0, 0x00, 0x5e, 0xff, 0xff, 0xb0,  //+@@@@@%...+@@@@@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+
+
+  /*Unicode: U+f04d () , Width: 18 */
+  0x06, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x30,  //.+++++++++++++++.. 
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,  //%@@@@@@@@@@@@@@@@. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@@@@@@@@@@+ 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //+@@@@@@@@@@@@@@@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+
+
+  /*Unicode: U+f051 () , Width: 13 */
+  0x07, 0x30, 0x00, 0x00, 0x00, 0x57, 0x70,  //.+........+++ 
+  0x7f, 0xf5, 0x00, 0x00, 0x00, 0xdf, 0xf0,  //+@@+......@@@ 
+  0x8f, 0xff, 0x60, 0x00, 0x00, 0xdf, 0xf0,  //%@@@+.....@@@ 
+  0x8f, 0xff, 0xf7, 0x00, 0x00, 0xdf, 0xf0,  //%@@@@+....@@@ 
+  0x8f, 0xff, 0xff, 0x80, 0x00, 0xdf, 0xf0,  //%@@@@@%...@@@ 
+  0x8f, 0xff, 0xff, 0xfa, 0x00, 0xdf, 0xf0,  //%@@@@@@%..@@@ 
+  0x8f, 0xff, 0xff, 0xff, 0xb0, 0xdf, 0xf0,  //%@@@@@@@%.@@@ 
+  0x8f, 0xff, 0xff, 0xff, 0xfc, 0xef, 0xf0,  //%@@@@@@@@@@@@ 
+  0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //%@@@@@@@@@@@@ 
+  0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //%@@@@@@@@@@@@ 
+  0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //%@@@@@@@@@@@@ 
+  0x8f, 0xff, 0xff, 0xff, 0xf4, 0xdf, 0xf0,  //%@@@@@@@@+@@@ 
+  0x8f, 0xff, 0xff, 0xfe, 0x30, 0xdf, 0xf0,  //%@@@@@@@..@@@ 
+  0x8f, 0xff, 0xff, 0xe2, 0x00, 0xdf, 0xf0,  //%@@@@@@...@@@ 
+  0x8f, 0xff, 0xfd, 0x20, 0x00, 0xdf, 0xf0,  //%@@@@@....@@@ 
+  0x8f, 0xff, 0xd1, 0x00, 0x00, 0xdf, 0xf0,  //%@@@@.....@@@ 
+  0x8f, 0xfc, 0x00, 0x00, 0x00, 0xdf, 0xf0,  //%@@@......@@@ 
+  0x4f, 0xb0, 0x00, 0x00, 0x00, 0xcf, 0xf0,  //+@%.......@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //............. 
+
+
+  /*Unicode: U+f052 () , Width: 18 */
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x0b, 0xff, 0x40, 0x00, 0x00, 0x00,  //.......%@@+....... 
+  0x00, 0x00, 0x00, 0xaf, 0xff, 0xf3, 0x00, 0x00, 0x00,  //......%@@@@....... 
+  0x00, 0x00, 0x08, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00,  //.....%@@@@@@...... 
+  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe1, 0x00, 0x00,  //....+@@@@@@@@..... 
+  0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00,  //...+@@@@@@@@@@.... 
+  0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,  //..+@@@@@@@@@@@@... 
+  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00,  //..@@@@@@@@@@@@@%.. 
+  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,  //.@@@@@@@@@@@@@@@%. 
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,  //@@@@@@@@@@@@@@@@@+ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@@@@@@@@@@+ 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //+@@@@@@@@@@@@@@@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,  //%@@@@@@@@@@@@@@@@. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,  //%@@@@@@@@@@@@@@@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+
+
+  /*Unicode: U+f053 () , Width: 11 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x05, 0xf8, 0x00,  //.......+@%. 
+  0x00, 0x00, 0x00, 0x5f, 0xff, 0x40,  //......+@@@+ 
+  0x00, 0x00, 0x05, 0xff, 0xfe, 0x20,  //.....+@@@@. 
+  0x00, 0x00, 0x5f, 0xff, 0xe2, 0x00,  //....+@@@@.. 
+  0x00, 0x05, 0xff, 0xfe, 0x20, 0x00,  //...+@@@@... 
+  0x00, 0x5f, 0xff, 0xe2, 0x00, 0x00,  //..+@@@@.... 
+  0x05, 0xff, 0xfe, 0x30, 0x00, 0x00,  //.+@@@@..... 
+  0x4f, 0xff, 0xe3, 0x00, 0x00, 0x00,  //+@@@@...... 
+  0xdf, 0xff, 0x50, 0x00, 0x00, 0x00,  //@@@@+...... 
+  0x4f, 0xff, 0xe3, 0x00, 0x00, 0x00,  //+@@@@...... 
+  0x04, 0xff, 0xfe, 0x30, 0x00, 0x00,  //.+@@@@..... 
+  0x00, 0x4f, 0xff, 0xe3, 0x00, 0x00,  //..+@@@@.... 
+  0x00, 0x04, 0xff, 0xfe, 0x30, 0x00,  //...+@@@@... 
+  0x00, 0x00, 0x4f, 0xff, 0xe3, 0x00,  //....+@@@@.. 
+  0x00, 0x00, 0x04, 0xff, 0xfe, 0x20,  //.....+@@@@. 
+  0x00, 0x00, 0x00, 0x5f, 0xff, 0x40,  //......+@@@+ 
+  0x00, 0x00, 0x00, 0x05, 0xf8, 0x00,  //.......+@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+f054 () , Width: 11 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x2d, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0xcf, 0xfc, 0x00, 0x00, 0x00, 0x00,  //@@@@....... 
+  0x9f, 0xff, 0xc0, 0x00, 0x00, 0x00,  //%@@@@...... 
+  0x09, 0xff, 0xfc, 0x00, 0x00, 0x00,  //.%@@@@..... 
+  0x00, 0x9f, 0xff, 0xc0, 0x00, 0x00,  //..%@@@@.... 
+  0x00, 0x09, 0xff, 0xfc, 0x00, 0x00,  //...%@@@@... 
+  0x00, 0x00, 0x9f, 0xff, 0xc0, 0x00,  //....%@@@@.. 
+  0x00, 0x00, 0x09, 0xff, 0xfc, 0x00,  //.....%@@@@. 
+  0x00, 0x00, 0x00, 0xdf, 0xff, 0x60,  //......@@@@+ 
+  0x00, 0x00, 0x09, 0xff, 0xfb, 0x00,  //.....%@@@%. 
+  0x00, 0x00, 0x9f, 0xff, 0xb0, 0x00,  //....%@@@%.. 
+  0x00, 0x09, 0xff, 0xfc, 0x00, 0x00,  //...%@@@@... 
+  0x00, 0x9f, 0xff, 0xc0, 0x00, 0x00,  //..%@@@@.... 
+  0x09, 0xff, 0xfc, 0x00, 0x00, 0x00,  //.%@@@@..... 
+  0x9f, 0xff, 0xc0, 0x00, 0x00, 0x00,  //%@@@@...... 
+  0xcf, 0xfc, 0x00, 0x00, 0x00, 0x00,  //@@@@....... 
+  0x2d, 0xb0, 0x00, 0x00, 0x00, 0x00,  //.@%........ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //........... 
+
+
+  /*Unicode: U+f067 () , Width: 18 */
+  0x00, 0x00, 0x00, 0x03, 0x77, 0x10, 0x00, 0x00, 0x00,  //........++........ 
+  0x00, 0x00, 0x00, 0x0e, 0xff, 0xa0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x6b, 0xbb, 0xbb, 0xbf, 0xff, 0xeb, 0xbb, 0xbb, 0xa1,  //+%%%%%%@@@@%%%%%%. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,  //%@@@@@@@@@@@@@@@@. 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xb0, 0x00, 0x00, 0x00,  //.......@@@%....... 
+  0x00, 0x00, 0x00, 0x0a, 0xff, 0x60, 0x00, 0x00, 0x00,  //.......%@@+....... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+
+
+  /*Unicode: U+f068 () , Width: 18 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x6b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xa1,  //+%%%%%%%%%%%%%%%%. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@@@@@@@@@@@+ 
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,  //%@@@@@@@@@@@@@@@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+
+
+  /*Unicode: U+f071 () , Width: 23 */
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........%@@@.......... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,  //.........@@@@%......... 
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,  //........@@@@@@+........ 
+  0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,  //.......+@@@@@@@........ 
+  0x00, 0x00, 0x00, 0x0d, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@@@@+....... 
+  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,  //......+@@@@@@@@@....... 
+  0x00, 0x00, 0x01, 0xef, 0xf9, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00,  //......@@@%...@@@%...... 
+  0x00, 0x00, 0x09, 0xff, 0xf9, 0x00, 0x1f, 0xff, 0xf1, 0x00, 0x00, 0x00,  //.....%@@@%...@@@@...... 
+  0x00, 0x00, 0x2f, 0xff, 0xfa, 0x00, 0x2f, 0xff, 0xfa, 0x00, 0x00, 0x00,  //.....@@@@%...@@@@%..... 
+  0x00, 0x00, 0xbf, 0xff, 0xfb, 0x00, 0x3f, 0xff, 0xff, 0x30, 0x00, 0x00,  //....%@@@@%...@@@@@..... 
+  0x00, 0x04, 0xff, 0xff, 0xfc, 0x00, 0x4f, 0xff, 0xff, 0xc0, 0x00, 0x00,  //...+@@@@@@..+@@@@@@.... 
+  0x00, 0x0d, 0xff, 0xff, 0xfd, 0x00, 0x5f, 0xff, 0xff, 0xf5, 0x00, 0x00,  //...@@@@@@@..+@@@@@@+... 
+  0x00, 0x6f, 0xff, 0xff, 0xff, 0xcc, 0xef, 0xff, 0xff, 0xfd, 0x00, 0x00,  //..+@@@@@@@@@@@@@@@@@... 
+  0x00, 0xef, 0xff, 0xff, 0xfe, 0x30, 0x9f, 0xff, 0xff, 0xff, 0x70, 0x00,  //..@@@@@@@@..%@@@@@@@+.. 
+  0x08, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xe1, 0x00,  //.%@@@@@@@%...@@@@@@@@.. 
+  0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xf9, 0x00,  //.@@@@@@@@%...@@@@@@@@%. 
+  0xaf, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x20,  //%@@@@@@@@@..%@@@@@@@@@. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0x18, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x95, 0x00,  //.%%%%%%%%%%%%%%%%%%%%+. 
+
+
+  /*Unicode: U+f074 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,  //...............++... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x00,  //...............@@+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x50,  //...............@@@+. 
+  0xff, 0xff, 0xf7, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xf5,  //@@@@@+......@@@@@@@+ 
+  0xff, 0xff, 0xff, 0x60, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff,  //@@@@@@+....@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xf5, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@+..%@@@@@@@@+ 
+  0x11, 0x12, 0xdf, 0xf8, 0x09, 0xff, 0xf7, 0x1f, 0xff, 0x70,  //....@@@%.%@@@+.@@@+. 
+  0x00, 0x00, 0x2e, 0xa0, 0x7f, 0xff, 0x80, 0x0f, 0xf7, 0x00,  //.....@%.+@@@%..@@+.. 
+  0x00, 0x00, 0x03, 0x05, 0xff, 0xfa, 0x00, 0x06, 0x60, 0x00,  //.......+@@@%...++... 
+  0x00, 0x00, 0x00, 0x4f, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00,  //......+@@@%......... 
+  0x00, 0x00, 0x03, 0xff, 0xfd, 0x03, 0x00, 0x06, 0x60, 0x00,  //......@@@@.....++... 
+  0x00, 0x00, 0x1e, 0xff, 0xe1, 0x3f, 0x90, 0x0f, 0xf7, 0x00,  //.....@@@@..@%..@@+.. 
+  0x11, 0x12, 0xdf, 0xfe, 0x21, 0xef, 0xf7, 0x1f, 0xff, 0x70,  //....@@@@..@@@+.@@@+. 
+  0xff, 0xff, 0xff, 0xf3, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xf7,  //@@@@@@@...@@@@@@@@@+ 
+  0xff, 0xff, 0xff, 0x50, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff,  //@@@@@@+....@@@@@@@@@ 
+  0xff, 0xff, 0xf7, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xf5,  //@@@@@+......@@@@@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x50,  //...............@@@+. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf5, 0x00,  //...............@@+.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00,  //...............++... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f077 () , Width: 17 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x02, 0xa2, 0x00, 0x00, 0x00, 0x00,  //........%........ 
+  0x00, 0x00, 0x00, 0x2e, 0xfe, 0x20, 0x00, 0x00, 0x00,  //.......@@@....... 
+  0x00, 0x00, 0x02, 0xef, 0xff, 0xe2, 0x00, 0x00, 0x00,  //......@@@@@...... 
+  0x00, 0x00, 0x2e, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00,  //.....@@@@@@@..... 
+  0x00, 0x02, 0xef, 0xff, 0x9f, 0xff, 0xe2, 0x00, 0x00,  //....@@@@%@@@@.... 
+  0x00, 0x2e, 0xff, 0xf6, 0x05, 0xff, 0xfe, 0x20, 0x00,  //...@@@@+.+@@@@... 
+  0x02, 0xef, 0xff, 0x60, 0x00, 0x5f, 0xff, 0xe2, 0x00,  //..@@@@+...+@@@@.. 
+  0x2e, 0xff, 0xf6, 0x00, 0x00, 0x05, 0xff, 0xfe, 0x20,  //.@@@@+.....+@@@@. 
+  0xdf, 0xff, 0x60, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xe0,  //@@@@+.......+@@@@ 
+  0xaf, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xb0,  //%@@+.........+@@% 
+  0x08, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00,  //.%+...........+%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+
+
+  /*Unicode: U+f078 () , Width: 17 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x08, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00,  //.%+...........+%. 
+  0xbf, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xb0,  //%@@+.........+@@% 
+  0xdf, 0xff, 0x60, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xe0,  //@@@@+.......+@@@@ 
+  0x2e, 0xff, 0xf6, 0x00, 0x00, 0x05, 0xff, 0xfe, 0x20,  //.@@@@+.....+@@@@. 
+  0x02, 0xef, 0xff, 0x60, 0x00, 0x5f, 0xff, 0xe2, 0x00,  //..@@@@+...+@@@@.. 
+  0x00, 0x2e, 0xff, 0xf6, 0x05, 0xff, 0xfe, 0x20, 0x00,  //...@@@@+.+@@@@... 
+  0x00, 0x02, 0xef, 0xff, 0x9f, 0xff, 0xe2, 0x00, 0x00,  //....@@@@%@@@@.... 
+  0x00, 0x00, 0x2e, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00,  //.....@@@@@@@..... 
+  0x00, 0x00, 0x02, 0xef, 0xff, 0xe2, 0x00, 0x00, 0x00,  //......@@@@@...... 
+  0x00, 0x00, 0x00, 0x2e, 0xfe, 0x20, 0x00, 0x00, 0x00,  //.......@@@....... 
+  0x00, 0x00, 0x00, 0x02, 0x92, 0x00, 0x00, 0x00, 0x00,  //........%........ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+
+
+  /*Unicode: U+f079 () , Width: 26 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................... 
+  0x00, 0x00, 0x7c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....+@.................... 
+  0x00, 0x08, 0xff, 0xe2, 0x00, 0x47, 0x77, 0x77, 0x77, 0x77, 0x71, 0x00, 0x00,  //...%@@@...+++++++++++..... 
+  0x00, 0x8f, 0xff, 0xfe, 0x20, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,  //..%@@@@@..@@@@@@@@@@@+.... 
+  0x08, 0xff, 0xff, 0xff, 0xe2, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,  //.%@@@@@@@.+@@@@@@@@@@+.... 
+  0x6f, 0xfd, 0xff, 0xdf, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00,  //+@@@@@@@@@.........@@+.... 
+  0x6f, 0xd1, 0xff, 0x77, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00,  //+@@.@@++@@.........@@+.... 
+  0x03, 0x10, 0xff, 0x70, 0x31, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00,  //....@@+............@@+.... 
+  0x00, 0x00, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00,  //....@@+............@@+.... 
+  0x00, 0x00, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf7, 0x00, 0x00,  //....@@+............@@+.... 
+  0x00, 0x00, 0xff, 0x70, 0x00, 0x00, 0x00, 0x01, 0xb7, 0x0f, 0xf7, 0x1c, 0x70,  //....@@+.........%+.@@+.@+. 
+  0x00, 0x00, 0xff, 0x70, 0x00, 0x00, 0x00, 0x09, 0xff, 0x6f, 0xf9, 0xdf, 0xf1,  //....@@+........%@@+@@%@@@. 
+  0x00, 0x00, 0xff, 0xb7, 0x77, 0x77, 0x77, 0x32, 0xef, 0xff, 0xff, 0xff, 0x80,  //....@@%+++++++..@@@@@@@@%. 
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2e, 0xff, 0xff, 0xf8, 0x00,  //....@@@@@@@@@@@..@@@@@@%.. 
+  0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x02, 0xef, 0xff, 0x80, 0x00,  //....@@@@@@@@@@@...@@@@%... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xf8, 0x00, 0x00,  //...................@@%.... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00,  //....................+..... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.......................... 
+
+
+  /*Unicode: U+f07b () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x5e, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@%........... 
+  0xef, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@@@@@@%.......... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x77, 0x77, 0x77, 0x60,  //@@@@@@@@@@%++++++++. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@@@@@@@@@@@@@@@@@% 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,  //@@@@@@@@@@@@@@@@@@@@ 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,  //+@@@@@@@@@@@@@@@@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................... 
+
+
+  /*Unicode: U+f093 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x50, 0x00, 0x00, 0x00, 0x00,  //........+@+......... 
+  0x00, 0x00, 0x00, 0x05, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x00,  //.......+@@@+........ 
+  0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00,  //......+@@@@@+....... 
+  0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00,  //.....+@@@@@@@+...... 
+  0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00,  //....+@@@@@@@@@+..... 
+  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00,  //...+@@@@@@@@@@@+.... 
+  0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00,  //...@@@@@@@@@@@@@.... 
+  0x00, 0x04, 0x44, 0x4f, 0xff, 0xff, 0x44, 0x44, 0x00, 0x00,  //...++++@@@@@++++.... 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,  //.......@@@@@........ 
+  0x69, 0x99, 0x99, 0x2f, 0xff, 0xff, 0x02, 0x99, 0x99, 0x96,  //+%%%%%.@@@@@..%%%%%+ 
+  0xff, 0xff, 0xff, 0x9c, 0xff, 0xfc, 0x09, 0xff, 0xff, 0xff,  //@@@@@@%@@@@@.%@@@@@@ 
+  0xff, 0xff, 0xff, 0xfd, 0xaa, 0xaa, 0xdf, 0xff, 0xff, 0xff,  //@@@@@@@@%%%%@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,  //@@@@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x2f, 0x38, 0xff,  //@@@@@@@@@@@@@%.@.%@@ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,  //@@@@@@@@@@@@@@@@@@@@ 
+  0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,  //.................... 
+
+
+  /*Unicode: U+f095 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfe, 0xb6,  //..............@@@@%+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,  //.............+@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff,  //.............@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0xfd,  //............+@@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xfb,  //............%@@@@@@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xf8,  //............+@@@@@@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xf4,  //.............+@@@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xe0,  //..............+@@@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0x90,  //..............%@@@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x10,  //.............+@@@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xf8, 0x00,  //.............@@@@%.. 
+  0x00, 0x00, 0x13, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xd0, 0x00,  //............@@@@@... 
+  0x00, 0x29, 0xff, 0x70, 0x00, 0x2d, 0xff, 0xff, 0x30, 0x00,  //...%@@+....@@@@@.... 
+  0x4b, 0xff, 0xff, 0xf4, 0x07, 0xff, 0xff, 0xf5, 0x00, 0x00,  //+%@@@@@+.+@@@@@+.... 
+  0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0x50, 0x00, 0x00,  //@@@@@@@@@@@@@@+..... 
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x00,  //@@@@@@@@@@@@@+...... 
+  0x8f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x00, 0x00, 0x00,  //%@@@@@@@@@@%........ 
+  0x4f, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x00, 0x00, 0x00, 0x00,  //+@@@@@@@@@+......... 
+  0x1f, 0xff, 0xff, 0xea, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,  //.@@@@@@%+........... 
+  0x05, 0x76, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.++++............... 
+
+
+  /*Unicode: U+f0c4 () , Width: 18 */
+  0x00, 0x47, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //..+++............. 
+  0x0b, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x33, 0x00,  //.%@@@@+........... 
+  0x8f, 0xff, 0xff, 0xf1, 0x00, 0x00, 0x3d, 0xff, 0xe3,  //%@@@@@@......@@@@. 
+  0xef, 0xc1, 0x5f, 0xf6, 0x00, 0x04, 0xff, 0xff, 0xe2,  //@@@.+@@+...+@@@@@. 
+  0xff, 0x90, 0x1f, 0xf7, 0x00, 0x6f, 0xff, 0xfd, 0x20,  //@@%..@@+..+@@@@@.. 
+  0xcf, 0xf9, 0xcf, 0xf5, 0x08, 0xff, 0xff, 0xd1, 0x00,  //@@@%@@@+.%@@@@@... 
+  0x3f, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xfc, 0x10, 0x00,  //.@@@@@@@%@@@@@.... 
+  0x03, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00,  //..@@@@@@@@@@%..... 
+  0x00, 0x00, 0x3f, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00,  //.....@@@@@@%...... 
+  0x00, 0x00, 0x0b, 0xff, 0xff, 0xf2, 0x00, 0x00, 0x00,  //.....%@@@@@....... 
+  0x00, 0x47, 0xbf, 0xff, 0xff, 0xfe, 0x10, 0x00, 0x00,  //..++%@@@@@@@...... 
+  0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00,  //.%@@@@@@@@@@@..... 
+  0x8f, 0xff, 0xff, 0xf9, 0x4f, 0xff, 0xfc, 0x00, 0x00,  //%@@@@@@%+@@@@@.... 
+  0xef, 0xc1, 0x5f, 0xf6, 0x05, 0xff, 0xff, 0xc0, 0x00,  //@@@.+@@+.+@@@@@... 
+  0xff, 0x90, 0x1f, 0xf7, 0x00, 0x7f, 0xff, 0xfb, 0x00,  //@@%..@@+..+@@@@%.. 
+  0xcf, 0xf9, 0xcf, 0xf4, 0x00, 0x08, 0xff, 0xff, 0xa0,  //@@@%@@@+...%@@@@%. 
+  0x3f, 0xff, 0xff, 0xb0, 0x00, 0x00, 0xaf, 0xff, 0xf6,  //.@@@@@%.....%@@@@+ 
+  0x03, 0xcf, 0xe8, 0x00, 0x00, 0x00, 0x08, 0xef, 0x90,  //..@@@%.......%@@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+
+
+  /*Unicode: U+f0c5 () , Width: 18 */
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x70, 0xfc, 0x10,  //.....@@@@@@@+.@@.. 
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x70, 0xff, 0xc1,  //.....@@@@@@@+.@@@. 
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x70, 0xff, 0xfa,  //.....@@@@@@@+.@@@% 
+  0x8b, 0xb8, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,  //%%%%.@@@@@@@%..... 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xd4, 0x33, 0x32,  //@@@%.@@@@@@@@+.... 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfb, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,  //@@@%.@@@@@@@@@@@@% 
+  0xff, 0xfd, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,  //@@@@.@@@@@@@@@@@@% 
+  0xff, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //@@@@%............. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //@@@@@@@@@@@@+..... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00,  //@@@@@@@@@@@@+..... 
+  0x57, 0x77, 0x77, 0x77, 0x77, 0x77, 0x10, 0x00, 0x00,  //++++++++++++...... 
+
+
+  /*Unicode: U+f0c7 () , Width: 17 */
+  0x17, 0x77, 0x77, 0x77, 0x77, 0x77, 0x60, 0x00, 0x00,  //.++++++++++++.... 
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00,  //@@@@@@@@@@@@@%... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00,  //@@@@@@@@@@@@@@%.. 
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfa, 0x00,  //@@%.........@@@%. 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x90,  //@@+.........@@@@% 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0,  //@@+.........@@@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0,  //@@+.........@@@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0,  //@@+.........@@@@@ 
+  0xff, 0xc7, 0x77, 0x77, 0x77, 0x78, 0xff, 0xff, 0xf0,  //@@@++++++++%@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xe4, 0x04, 0xef, 0xff, 0xff, 0xf0,  //@@@@@@@+.+@@@@@@@ 
+  0xff, 0xff, 0xff, 0x60, 0x00, 0x6f, 0xff, 0xff, 0xf0,  //@@@@@@+...+@@@@@@ 
+  0xff, 0xff, 0xff, 0x40, 0x00, 0x4f, 0xff, 0xff, 0xf0,  //@@@@@@+...+@@@@@@ 
+  0xff, 0xff, 0xff, 0xa0, 0x00, 0xaf, 0xff, 0xff, 0xf0,  //@@@@@@%...%@@@@@@ 
+  0xff, 0xff, 0xff, 0xfc, 0x8b, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@%%@@@@@@@ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,  //@@@@@@@@@@@@@@@@@ 
+  0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //+@@@@@@@@@@@@@@@+ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //................. 
+
+
+  /*Unicode: U+f0e7 () , Width: 13 */
+  0x0b, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00,  //.%@@@@@@%.... 
+  0x0d, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,  //.@@@@@@@%.... 
+  0x0f, 0xff, 0xff, 0xff, 0x30, 0x00, 0x00,  //.@@@@@@@..... 
+  0x2f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,  //.@@@@@@@..... 
+  0x4f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,  //+@@@@@@%..... 
+  0x6f, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00,  //+@@@@@@...... 
+  0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,  //%@@@@@@@@@@@+ 
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,  //%@@@@@@@@@@@+ 
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,  //@@@@@@@@@@@@. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x00,  //@@@@@@@@@@@.. 
+  0xcf, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00,  //@@@@@@@@@@%.. 
+  0x00, 0x00, 0x08, 0xff, 0xfe, 0x10, 0x00,  //.....%@@@@... 
+  0x00, 0x00, 0x0c, 0xff, 0xf6, 0x00, 0x00,  //.....@@@@+... 
+  0x00, 0x00, 0x0f, 0xff, 0xd0, 0x00, 0x00,  //.....@@@@.... 
+  0x00, 0x00, 0x3f, 0xff, 0x40, 0x00, 0x00,  //.....@@@+.... 
+  0x00, 0x00, 0x7f, 0xfb, 0x00, 0x00, 0x00,  //....+@@%..... 
+  0x00, 0x00, 0xbf, 0xf2, 0x00, 0x00, 0x00,  //....%@@...... 
+  0x00, 0x00, 0xef, 0x80, 0x00, 0x00, 0x00,  //....@@%...... 
+  0x00, 0x02, 0xfe, 0x00, 0x00, 0x00, 0x00,  //....@@....... 
+  0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00,  //....%+....... 
+
+
+  /*Unicode: U+f0f3 () , Width: 18 */
+  0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00,  //.......%@%........ 
+  0x00, 0x00, 0x00, 0x0c, 0xfc, 0x00, 0x00, 0x00, 0x00,  //.......@@@........ 
+  0x00, 0x00, 0x07, 0xef, 0xff, 0xf9, 0x10, 0x00, 0x00,  //.....+@@@@@%...... 
+  0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00,  //....%@@@@@@@@..... 
+  0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,  //...%@@@@@@@@@@.... 
+  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00,  //...@@@@@@@@@@@+... 
+  0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00,  //..+@@@@@@@@@@@@... 
+  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..+@@@@@@@@@@@@... 
+  0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,  //..%@@@@@@@@@@@@... 
+  0x00, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x00,  //..%@@@@@@@@@@@@... 
+  0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00,  //..@@@@@@@@@@@@@+.. 
+  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //..@@@@@@@@@@@@@%.. 
+  0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10,  //.%@@@@@@@@@@@@@@.. 
+  0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,  //+@@@@@@@@@@@@@@@@. 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,  //@@@@@@@@@@@@@@@@@+ 
+  0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,  //%@@@@@@@@@@@@@@@@. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //.................. 
+  0x00, 0x00, 0x00, 0xef, 0xff, 0xe0, 0x00, 0x00, 0x00,  //......@@@@@....... 
+  0x00, 0x00, 0x00, 0x7f, 0xff, 0x70, 0x00, 0x00, 0x00,  //......+@@@+....... 
+  0x00, 0x00, 0x00, 0x04, 0x74, 0x00, 0x00, 0x00, 0x00,  //.......+++........ 
+
+
+  /*Unicode: U+f11c () , Width: 23 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00,  //+@@@@@@@@@@@@@@@@@@@@%. 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xc7, 0x8f, 0x97, 0x9f, 0x87, 0x9f, 0x88, 0xf9, 0x78, 0xff, 0x70,  //@@@+%@%+%@%+%@%%@%+%@@+ 
+  0xff, 0x70, 0x0f, 0x20, 0x2f, 0x00, 0x2f, 0x00, 0xf2, 0x00, 0xff, 0x70,  //@@+..@...@...@..@...@@+ 
+  0xff, 0x80, 0x0f, 0x30, 0x3f, 0x00, 0x3f, 0x00, 0xf3, 0x00, 0xff, 0x70,  //@@%..@...@...@..@...@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0xff, 0x82, 0x4f, 0x42, 0x5f, 0x33, 0xf5, 0x22, 0xef, 0xff, 0x70,  //@@@@%.+@+.+@..@+..@@@@+ 
+  0xff, 0xff, 0x50, 0x1f, 0x10, 0x2f, 0x00, 0xf2, 0x00, 0xdf, 0xff, 0x70,  //@@@@+..@...@..@...@@@@+ 
+  0xff, 0xff, 0x82, 0x4f, 0x42, 0x5f, 0x33, 0xf5, 0x22, 0xef, 0xff, 0x70,  //@@@@%.+@+.+@..@+..@@@@+ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0x80, 0x0f, 0x30, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x00, 0xff, 0x70,  //@@%..@..........@...@@+ 
+  0xff, 0x70, 0x0f, 0x20, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x00, 0xff, 0x70,  //@@+..@..........@...@@+ 
+  0xff, 0xc7, 0x8f, 0xa7, 0x77, 0x77, 0x77, 0x78, 0xf9, 0x78, 0xff, 0x70,  //@@@+%@%++++++++%@%+%@@+ 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,  //@@@@@@@@@@@@@@@@@@@@@@+ 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00,  //+@@@@@@@@@@@@@@@@@@@@%. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //....................... 
+
+
+  /*Unicode: U+f124 () , Width: 20 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xef, 0xfa,  //...............+@@@% 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff,  //.............%@@@@@@ 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xfa,  //...........%@@@@@@@% 
+  0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xff, 0xff, 0xff, 0xf3,  //........+%@@@@@@@@@. 
+  0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,  //......+@@@@@@@@@@@%. 
+  0x00, 0x00, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,  //....+@@@@@@@@@@@@@+. 
+  0x01, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00,  //..%@@@@@@@@@@@@@@@.. 
+  0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00,  //+@@@@@@@@@@@@@@@@+.. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,  //@@@@@@@@@@@@@@@@@... 
+  0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00,  //@@@@@@@@@@@@@@@@+... 
+  0x3b, 0xbb, 0xbb, 0xbb, 0xcf, 0xff, 0xff, 0xff, 0x00, 0x00,  //.%%%%%%%@@@@@@@@.... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00,  //.........@@@@@@%.... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf1, 0x00, 0x00,  //.........@@@@@@..... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x90, 0x00, 0x00,  //.........@@@@@%..... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x20, 0x00, 0x00,  //.........@@@@@...... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xfb, 0x00, 0x00, 0x00,  //.........@@@@%...... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xf3, 0x00, 0x00, 0x00,  //.........@@@@....... 
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x00,  //.........@@@@....... 
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x40, 0x00, 0x00, 0x00,  //.........@@@+....... 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x73, 0x00, 0x00, 0x00, 0x00,  //..........+......... 
+
+
+  /*Unicode: U+f15b () , Width: 15 */
+  0xcf, 0xff, 0xff, 0xff, 0xb0, 0xe3, 0x00, 0x00,  //@@@@@@@@%.@.... 
+  0xff, 0xff, 0xff, 0xff, 0xb0, 0xfe, 0x30, 0x00,  //@@@@@@@@%.@@... 
+  0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xe3, 0x00,  //@@@@@@@@%.@@@.. 
+  0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xfe, 0x30,  //@@@@@@@@%.@@@@. 
+  0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xff, 0xe0,  //@@@@@@@@%.@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00,  //@@@@@@@@@...... 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,  //@@@@@@@@@@@@@@@ 
+  0x8b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x80,  //%%%%%%%%%%%%%%% 
+
+
+  /*Unicode: U+f1eb () , Width: 25 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //............+............ 
+  0x00, 0x00, 0x00, 0x38, 0xcf, 0xff, 0xff, 0xff, 0xc8, 0x30, 0x00, 0x00, 0x00,  //.......%@@@@@@@@@%....... 
+  0x00, 0x00, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x00, 0x00,  //....+@@@@@@@@@@@@@@@+.... 
+  0x00, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x00,  //...@@@@@@@@@@@@@@@@@@@... 
+  0x08, 0xff, 0xff, 0xfb, 0x72, 0x00, 0x00, 0x02, 0x7b, 0xff, 0xff, 0xf8, 0x00,  //.%@@@@@%+.......+%@@@@@%. 
+  0xaf, 0xff, 0xfa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xa0,  //%@@@@%.............%@@@@% 
+  0xbf, 0xfd, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xb0,  //%@@@.................@@@% 
+  0x0b, 0xa0, 0x00, 0x01, 0x6b, 0xdf, 0xfe, 0xc7, 0x20, 0x00, 0x00, 0xab, 0x00,  //.%%.....+%@@@@@+......%%. 
+  0x00, 0x00, 0x01, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x00, 0x00, 0x00,  //......%@@@@@@@@@@%....... 
+  0x00, 0x00, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x00, 0x00,  //....+@@@@@@@@@@@@@@+..... 
+  0x00, 0x00, 0xef, 0xff, 0xe8, 0x42, 0x23, 0x7c, 0xff, 0xff, 0x20, 0x00, 0x00,  //....@@@@@%+...+@@@@@..... 
+  0x00, 0x00, 0x3f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xf7, 0x00, 0x00, 0x00,  //.....@@+........+@@+..... 
+  0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00,  //..................+...... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%@%........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@%.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........@@@@@.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,  //..........%@@@%.......... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,  //...........%@%........... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+
+
+  /*Unicode: U+f240 () , Width: 25 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x06, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50, 0x00,  //.++++++++++++++++++++++.. 
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@%. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,  //@@@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+..................%@@@ 
+  0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xf0,  //@@+.@@@@@@@@@@@@@@@@.%@@@ 
+  0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xbf, 0xf0,  //@@+.@@@@@@@@@@@@@@@@.+%@@ 
+  0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xf0,  //@@+.@@@@@@@@@@@@@@@@..+@@ 
+  0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xf0,  //@@+.@@@@@@@@@@@@@@@@..+@@ 
+  0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0xff, 0xf0,  //@@+.@@@@@@@@@@@@@@@@.%@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0,  //@@+..................%@@@ 
+  0xff, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7d, 0xfb, 0x00,  //@@%++++++++++++++++++@@%. 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@%. 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00,  //+@@@@@@@@@@@@@@@@@@@@@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+
+
+  /*Unicode: U+f241 () , Width: 25 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x06, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50, 0x00,  //.++++++++++++++++++++++.. 
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@%. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,  //@@@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+..................%@@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x0b, 0xff, 0xf0,  //@@+.@@@@@@@@@@@@+....%@@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x05, 0xbf, 0xf0,  //@@+.@@@@@@@@@@@@+....+%@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x7f, 0xf0,  //@@+.@@@@@@@@@@@@+.....+@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x7f, 0xf0,  //@@+.@@@@@@@@@@@@+.....+@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x0b, 0xff, 0xf0,  //@@+.@@@@@@@@@@@@+....%@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0,  //@@+..................%@@@ 
+  0xff, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7d, 0xfb, 0x00,  //@@%++++++++++++++++++@@%. 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@%. 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00,  //+@@@@@@@@@@@@@@@@@@@@@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+
+
+  /*Unicode: U+f242 () , Width: 25 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x06, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50, 0x00,  //.++++++++++++++++++++++.. 
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@%. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,  //@@@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+..................%@@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+.@@@@@@@@%........%@@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xf0,  //@@+.@@@@@@@@%........+%@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0,  //@@+.@@@@@@@@%.........+@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0,  //@@+.@@@@@@@@%.........+@@ 
+  0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+.@@@@@@@@%........%@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0,  //@@+..................%@@@ 
+  0xff, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7d, 0xfb, 0x00,  //@@%++++++++++++++++++@@%. 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@%. 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00,  //+@@@@@@@@@@@@@@@@@@@@@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+
+
+  /*Unicode: U+f243 () , Width: 25 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x06, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50, 0x00,  //.++++++++++++++++++++++.. 
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@%. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,  //@@@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+..................%@@@ 
+  0xff, 0x70, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+.@@@@@............%@@@ 
+  0xff, 0x70, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xf0,  //@@+.@@@@@............+%@@ 
+  0xff, 0x70, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0,  //@@+.@@@@@.............+@@ 
+  0xff, 0x70, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0,  //@@+.@@@@@.............+@@ 
+  0xff, 0x70, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+.@@@@@............%@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0,  //@@+..................%@@@ 
+  0xff, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7d, 0xfb, 0x00,  //@@%++++++++++++++++++@@%. 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@%. 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00,  //+@@@@@@@@@@@@@@@@@@@@@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+
+
+  /*Unicode: U+f244 () , Width: 25 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x06, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50, 0x00,  //.++++++++++++++++++++++.. 
+  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //%@@@@@@@@@@@@@@@@@@@@@@%. 
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x40,  //@@@@@@@@@@@@@@@@@@@@@@@@+ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+..................%@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+..................%@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xf0,  //@@+..................+%@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0,  //@@+...................+@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0,  //@@+...................+@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xf0,  //@@+..................%@@@ 
+  0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0,  //@@+..................%@@@ 
+  0xff, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7d, 0xfb, 0x00,  //@@%++++++++++++++++++@@%. 
+  0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x00,  //@@@@@@@@@@@@@@@@@@@@@@@%. 
+  0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00,  //+@@@@@@@@@@@@@@@@@@@@@@.. 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //......................... 
+
+
+  /*Unicode: U+f293 () , Width: 15 */
+  0x00, 0x01, 0x7b, 0xef, 0xed, 0x92, 0x00, 0x00,  //....+%@@@@%.... 
+  0x00, 0x4e, 0xff, 0xfd, 0xff, 0xff, 0x60, 0x00,  //..+@@@@@@@@@+.. 
+  0x03, 0xff, 0xff, 0xf1, 0xdf, 0xff, 0xf5, 0x00,  //..@@@@@.@@@@@+. 
+  0x0c, 0xff, 0xff, 0xf0, 0x2e, 0xff, 0xfe, 0x00,  //.@@@@@@..@@@@@. 
+  0x3f, 0xff, 0xff, 0xf0, 0x02, 0xef, 0xff, 0x40,  //.@@@@@@...@@@@+ 
+  0x8f, 0xfe, 0xcf, 0xf0, 0x61, 0x3f, 0xff, 0x80,  //%@@@@@@.+..@@@% 
+  0xbf, 0xf5, 0x0c, 0xf0, 0x8d, 0x05, 0xff, 0xb0,  //%@@+.@@.%@.+@@% 
+  0xdf, 0xfe, 0x20, 0xb0, 0x76, 0x0c, 0xff, 0xd0,  //@@@@..%.++.@@@@ 
+  0xff, 0xff, 0xe2, 0x00, 0x00, 0xbf, 0xff, 0xf0,  //@@@@@.....%@@@@ 
+  0xff, 0xff, 0xfe, 0x20, 0x09, 0xff, 0xff, 0xf0,  //@@@@@@...%@@@@@ 
+  0xff, 0xff, 0xff, 0x50, 0x0c, 0xff, 0xff, 0xf0,  //@@@@@@+..@@@@@@ 
+  0xff, 0xff, 0xf5, 0x00, 0x00, 0xcf, 0xff, 0xf0,  //@@@@@+....@@@@@ 
+  0xef, 0xff, 0x50, 0x80, 0x62, 0x1d, 0xff, 0xe0,  //@@@@+.%.+..@@@@ 
+  0xcf, 0xf6, 0x08, 0xf0, 0x7d, 0x02, 0xff, 0xc0,  //@@@+.%@.+@..@@@ 
+  0x9f, 0xfc, 0x9f, 0xf0, 0x74, 0x0c, 0xff, 0x90,  //%@@@%@@.++.@@@% 
+  0x4f, 0xff, 0xff, 0xf1, 0x00, 0xcf, 0xff, 0x50,  //+@@@@@@...@@@@+ 
+  0x0d, 0xff, 0xff, 0xf1, 0x0c, 0xff, 0xfe, 0x00,  //.@@@@@@..@@@@@. 
+  0x04, 0xff, 0xff, 0xf2, 0xcf, 0xff, 0xf7, 0x00,  //.+@@@@@.@@@@@+. 
+  0x00, 0x4e, 0xff, 0xfd, 0xff, 0xff, 0x90, 0x00,  //..+@@@@@@@@@%.. 
+  0x00, 0x01, 0x7c, 0xef, 0xfd, 0xa4, 0x00, 0x00,  //....+@@@@@%+... 
+
+
+};
+
+
+/*Store the glyph descriptions*/
+static const lv_font_glyph_dsc_t symbols_20_glyph_dsc[] = 
+{
+  {.w_px = 20,	.glyph_index = 0},	/*Unicode: U+f001 ()*/
+  {.w_px = 20,	.glyph_index = 200},	/*Unicode: U+f008 ()*/
+  {.w_px = 20,	.glyph_index = 400},	/*Unicode: U+f00b ()*/
+  {.w_px = 20,	.glyph_index = 600},	/*Unicode: U+f00c ()*/
+  {.w_px = 14,	.glyph_index = 800},	/*Unicode: U+f00d ()*/
+  {.w_px = 20,	.glyph_index = 940},	/*Unicode: U+f011 ()*/
+  {.w_px = 20,	.glyph_index = 1140},	/*Unicode: U+f013 ()*/
+  {.w_px = 6,	.glyph_index = 1340},	/*Unicode: U+f014 ()*/
+  {.w_px = 23,	.glyph_index = 1400},	/*Unicode: U+f015 ()*/
+  {.w_px = 20,	.glyph_index = 1640},	/*Unicode: U+f019 ()*/
+  {.w_px = 23,	.glyph_index = 1840},	/*Unicode: U+f01c ()*/
+  {.w_px = 20,	.glyph_index = 2080},	/*Unicode: U+f021 ()*/
+  {.w_px = 10,	.glyph_index = 2280},	/*Unicode: U+f026 ()*/
+  {.w_px = 15,	.glyph_index = 2380},	/*Unicode: U+f027 ()*/
+  {.w_px = 23,	.glyph_index = 2540},	/*Unicode: U+f028 ()*/
+  {.w_px = 20,	.glyph_index = 2780},	/*Unicode: U+f03e ()*/
+  {.w_px = 6,	.glyph_index = 2980},	/*Unicode: U+f040 ()*/
+  {.w_px = 13,	.glyph_index = 3040},	/*Unicode: U+f048 ()*/
+  {.w_px = 18,	.glyph_index = 3180},	/*Unicode: U+f04b ()*/
+  {.w_px = 18,	.glyph_index = 3360},	/*Unicode: U+f04c ()*/
+  {.w_px = 18,	.glyph_index = 3540},	/*Unicode: U+f04d ()*/
+  {.w_px = 13,	.glyph_index = 3720},	/*Unicode: U+f051 ()*/
+  {.w_px = 18,	.glyph_index = 3860},	/*Unicode: U+f052 ()*/
+  {.w_px = 11,	.glyph_index = 4040},	/*Unicode: U+f053 ()*/
+  {.w_px = 11,	.glyph_index = 4160},	/*Unicode: U+f054 ()*/
+  {.w_px = 18,	.glyph_index = 4280},	/*Unicode: U+f067 ()*/
+  {.w_px = 18,	.glyph_index = 4460},	/*Unicode: U+f068 ()*/
+  {.w_px = 23,	.glyph_index = 4640},	/*Unicode: U+f071 ()*/
+  {.w_px = 20,	.glyph_index = 4880},	/*Unicode: U+f074 ()*/
+  {.w_px = 17,	.glyph_index = 5080},	/*Unicode: U+f077 ()*/
+  {.w_px = 17,	.glyph_index = 5260},	/*Unicode: U+f078 ()*/
+  {.w_px = 26,	.glyph_index = 5440},	/*Unicode: U+f079 ()*/
+  {.w_px = 20,	.glyph_index = 5700},	/*Unicode: U+f07b ()*/
+  {.w_px = 20,	.glyph_index = 5900},	/*Unicode: U+f093 ()*/
+  {.w_px = 20,	.glyph_index = 6100},	/*Unicode: U+f095 ()*/
+  {.w_px = 18,	.glyph_index = 6300},	/*Unicode: U+f0c4 ()*/
+  {.w_px = 18,	.glyph_index = 6480},	/*Unicode: U+f0c5 ()*/
+  {.w_px = 17,	.glyph_index = 6660},	/*Unicode: U+f0c7 ()*/
+  {.w_px = 13,	.glyph_index = 6840},	/*Unicode: U+f0e7 ()*/
+  {.w_px = 18,	.glyph_index = 6980},	/*Unicode: U+f0f3 ()*/
+  {.w_px = 23,	.glyph_index = 7160},	/*Unicode: U+f11c ()*/
+  {.w_px = 20,	.glyph_index = 7400},	/*Unicode: U+f124 ()*/
+  {.w_px = 15,	.glyph_index = 7600},	/*Unicode: U+f15b ()*/
+  {.w_px = 25,	.glyph_index = 7760},	/*Unicode: U+f1eb ()*/
+  {.w_px = 25,	.glyph_index = 8020},	/*Unicode: U+f240 ()*/
+  {.w_px = 25,	.glyph_index = 8280},	/*Unicode: U+f241 ()*/
+  {.w_px = 25,	.glyph_index = 8540},	/*Unicode: U+f242 ()*/
+  {.w_px = 25,	.glyph_index = 8800},	/*Unicode: U+f243 ()*/
+  {.w_px = 25,	.glyph_index = 9060},	/*Unicode: U+f244 ()*/
+  {.w_px = 15,	.glyph_index = 9320},	/*Unicode: U+f293 ()*/
+};
+
+/*List of unicode characters*/
+static const uint32_t symbols_20_unicode_list[] = {
+  61441,	/*Unicode: U+f001 ()*/
+  61448,	/*Unicode: U+f008 ()*/
+  61451,	/*Unicode: U+f00b ()*/
+  61452,	/*Unicode: U+f00c ()*/
+  61453,	/*Unicode: U+f00d ()*/
+  61457,	/*Unicode: U+f011 ()*/
+  61459,	/*Unicode: U+f013 ()*/
+  61460,	/*Unicode: U+f014 ()*/
+  61461,	/*Unicode: U+f015 ()*/
+  61465,	/*Unicode: U+f019 ()*/
+  61468,	/*Unicode: U+f01c ()*/
+  61473,	/*Unicode: U+f021 ()*/
+  61478,	/*Unicode: U+f026 ()*/
+  61479,	/*Unicode: U+f027 ()*/
+  61480,	/*Unicode: U+f028 ()*/
+  61502,	/*Unicode: U+f03e ()*/
+  61504,	/*Unicode: U+f040 ()*/
+  61512,	/*Unicode: U+f048 ()*/
+  61515,	/*Unicode: U+f04b ()*/
+  61516,	/*Unicode: U+f04c ()*/
+  61517,	/*Unicode: U+f04d ()*/
+  61521,	/*Unicode: U+f051 ()*/
+  61522,	/*Unicode: U+f052 ()*/
+  61523,	/*Unicode: U+f053 ()*/
+  61524,	/*Unicode: U+f054 ()*/
+  61543,	/*Unicode: U+f067 ()*/
+  61544,	/*Unicode: U+f068 ()*/
+  61553,	/*Unicode: U+f071 ()*/
+  61556,	/*Unicode: U+f074 ()*/
+  61559,	/*Unicode: U+f077 ()*/
+  61560,	/*Unicode: U+f078 ()*/
+  61561,	/*Unicode: U+f079 ()*/
+  61563,	/*Unicode: U+f07b ()*/
+  61587,	/*Unicode: U+f093 ()*/
+  61589,	/*Unicode: U+f095 ()*/
+  61636,	/*Unicode: U+f0c4 ()*/
+  61637,	/*Unicode: U+f0c5 ()*/
+  61639,	/*Unicode: U+f0c7 ()*/
+  61671,	/*Unicode: U+f0e7 ()*/
+  61683,	/*Unicode: U+f0f3 ()*/
+  61724,	/*Unicode: U+f11c ()*/
+  61732,	/*Unicode: U+f124 ()*/
+  61787,	/*Unicode: U+f15b ()*/
+  61931,	/*Unicode: U+f1eb ()*/
+  62016,	/*Unicode: U+f240 ()*/
+  62017,	/*Unicode: U+f241 ()*/
+  62018,	/*Unicode: U+f242 ()*/
+  62019,	/*Unicode: U+f243 ()*/
+  62020,	/*Unicode: U+f244 ()*/
+  62099,	/*Unicode: U+f293 ()*/
+  0,    /*End indicator*/
+};
+
+lv_font_t symbols_20 = 
+{
+    .unicode_first = 61440,	/*First Unicode letter in this font*/
+    .unicode_last = 62190,	/*Last Unicode letter in this font*/
+    .h_px = 20,				/*Font height in pixels*/
+    .glyph_bitmap = symbols_20_glyph_bitmap,	/*Bitmap of glyphs*/
+    .glyph_dsc = symbols_20_glyph_dsc,		/*Description of glyphs*/
+    .glyph_cnt = 50,			/*Number of glyphs in the font*/
+    .unicode_list = symbols_20_unicode_list,	/*List of unicode characters*/
+    .get_bitmap = lv_font_get_bitmap_sparse,	/*Function pointer to get glyph's bitmap*/
+    .get_width = lv_font_get_width_sparse,	/*Function pointer to get glyph's width*/
+    .bpp = 4,				/*Bit per pixel*/
+    .monospace = 0,				/*Fix width (0: if not used)*/
+    .next_page = NULL,		/*Pointer to a font extension*/
+};
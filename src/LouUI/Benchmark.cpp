@@ -0,0 +1,180 @@
+/**
+ * @file Benchmark.cpp
+ * @brief Implementation of Benchmark
+ * @details Implements the Benchmark class and, with LOUUI_BENCHMARK, the
+ * counting operator new
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+#include "Chart.hpp"
+#include "Color.hpp"
+#include "DropDownMenu.hpp"
+#include "Label.hpp"
+#include "Memory.hpp"
+#include "Pixels.hpp"
+#include "ToggleButton.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+uint32_t LouUI::Benchmark::getAllocations() {
+    return Memory::getNewCount();
+}
+
+bool LouUI::Benchmark::countsAllocations() {
+#ifdef LOUUI_BENCHMARK
+    return true;
+#else
+    return false;
+#endif
+}
+
+void LouUI::Benchmark::print(const LouUI::Benchmark::Result &r) {
+    if(r.allocsPerOp < 0){
+        std::printf("LouUI bench %-32s %12.1f ns/op %10s allocs/op\n",
+                    r.name.c_str(), r.nsPerOp, "-");
+    }else{
+        std::printf("LouUI bench %-32s %12.1f ns/op %10.2f allocs/op\n",
+                    r.name.c_str(), r.nsPerOp, r.allocsPerOp);
+    }
+}
+
+std::vector<LouUI::Benchmark::Result>
+LouUI::Benchmark::runAll(LouUI::Display &display, const std::string &screen) {
+    std::vector<Result> results;
+    lv_obj_t *scratch = lv_obj_create(lv_scr_act(), nullptr);
+    lv_obj_set_hidden(scratch, true);
+
+    Chart *chart = (new Chart(scratch))
+            ->setPointCount(300)
+            ->addSeries("data", Color("RED"));
+    results.push_back(run("Chart::addData", 1000, [chart](uint32_t i){
+        chart->addData("data", (int16_t)(i % 100));
+    }));
+
+    Label *label = new Label(scratch);
+    results.push_back(run("Label::setText changed", 1000,
+                          [label](uint32_t i){
+        label->setText(i % 2 ? "Auton 1: Left" : "Auton 2: Right");
+    }));
+    results.push_back(run("Label::setText unchanged", 1000,
+                          [label](uint32_t){
+        label->setText("Auton 1: Left");
+    }));
+
+    results.push_back(run("Color(std::string)", 1000, [](uint32_t){
+        volatile lv_color_t c = Color("PURPLE").toLvColor();
+        (void)c;
+    }));
+    results.push_back(run("Color(int, int, int)", 1000, [](uint32_t i){
+        volatile lv_color_t c = Color(i % 256, 125, 0).toLvColor();
+        (void)c;
+    }));
+
+    ToggleButton *button = new ToggleButton(scratch);
+    results.push_back(run("ToggleButton style setters", 100,
+                          [button](uint32_t i){
+        button->setMainColor(Color(i % 256, 125, 0), ToggleButton::RELEASED)
+                ->setGradientColor(Color(i % 256, 125, 0),
+                                   ToggleButton::RELEASED)
+                ->setBorderColor(Color("WHITE"), ToggleButton::ALL)
+                ->setBorderWidth(2, ToggleButton::ALL)
+                ->setRadius(4, ToggleButton::ALL);
+    }));
+
+    DropDownMenu *menu = new DropDownMenu(scratch);
+    for(int count : {10, 100, 1000}){
+        std::vector<std::string> options;
+        for(int i = 0; i < count; i++){
+            options.push_back("Option " + std::to_string(i));
+        }
+        results.push_back(run("DropDownMenu::setOptions " +
+                              std::to_string(count), 10,
+                              [menu, &options](uint32_t){
+            menu->setOptions(options);
+        }));
+    }
+
+    results.push_back(run("Display::getScreen", 1000,
+                          [&display, &screen](uint32_t){
+        volatile lv_obj_t *s = display.getScreen(screen);
+        (void)s;
+    }));
+
+    //one row of the screen, to compare the vector kernels per pixel
+    std::vector<lv_color_t> row(LV_HOR_RES), overlay(LV_HOR_RES);
+    lv_color_t *dest = row.data();
+    const lv_color_t *src = overlay.data();
+    lv_color_t color = Color("RED").toLvColor();
+    results.push_back(run("Pixels::fillScalar 480 px", 1000,
+                          [dest, color](uint32_t){
+        Pixels::fillScalar(dest, LV_HOR_RES, color);
+    }));
+    results.push_back(run("Pixels::fill 480 px", 1000,
+                          [dest, color](uint32_t){
+        Pixels::fill(dest, LV_HOR_RES, color);
+    }));
+    results.push_back(run("Pixels::blendScalar 480 px", 1000,
+                          [dest, src](uint32_t){
+        Pixels::blendScalar(dest, src, LV_HOR_RES, LV_OPA_50);
+    }));
+    results.push_back(run("Pixels::blend 480 px", 1000,
+                          [dest, src](uint32_t){
+        Pixels::blend(dest, src, LV_HOR_RES, LV_OPA_50);
+    }));
+
+    std::vector<float> values(LV_HOR_RES);
+    std::vector<uint8_t> indices(LV_HOR_RES);
+    for(size_t i = 0; i < values.size(); i++) values[i] = i % 100;
+    float *in = values.data();
+    uint8_t *out = indices.data();
+    results.push_back(run("Pixels::quantizeScalar 480 values", 1000,
+                          [in, out](uint32_t){
+        Pixels::quantizeScalar(in, out, LV_HOR_RES, 0, 2.55f);
+    }));
+    results.push_back(run("Pixels::quantize 480 values", 1000,
+                          [in, out](uint32_t){
+        Pixels::quantize(in, out, LV_HOR_RES, 0, 2.55f);
+    }));
+
+    lv_obj_del(scratch);
+    //the elements have no destructors, so their styles are freed here
+    Memory::free(chart->getStyle());
+    Memory::free(label->getStyle());
+    Memory::free(button->getReleasedStyle());
+    Memory::free(button->getPressedStyle());
+    Memory::free(button->getToggledReleasedStyle());
+    Memory::free(button->getToggledPressedStyle());
+    Memory::free(button->getInactiveStyle());
+    Memory::free(menu->getBackgroundStyle());
+    Memory::free(menu->getSelectedStyle());
+    Memory::free(menu->getScrollbarStyle());
+    delete chart;
+    delete label;
+    delete button;
+    delete menu;
+
+    for(const Result &r : results) print(r);
+    return results;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file Benchmark.hpp
+ * @brief Microbenchmarks for LouUI
+ * @details Contains the Benchmark class, which times LouUI operations on the
+ * brain and reports the time and allocations per operation.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_BENCHMARK_HPP
+#define LOUUI_BENCHMARK_HPP
+
+#include <string>
+#include <vector>
+
+#include "../../include/api.h"
+#include "Display.hpp"
+
+namespace LouUI {
+    /**
+     * @class Benchmark
+     * @brief Times LouUI operations
+     * @details
+     * Benchmarks run on the brain, against the real lvgl, and report
+     * nanoseconds per operation. When the project is built with
+     * LOUUI_BENCHMARK set to 1 in the Makefile, every operator new is
+     * counted as well and allocations per operation are reported.
+     * @subsection usage Usage
+     * @code
+     * //in initialize(), after the display is created
+     * LouUI::Benchmark::runAll(display, "Auton Selector");
+     * @endcode
+     * The results are printed to the terminal.
+     */
+    class Benchmark {
+    public:
+
+        /**
+         * @struct Result
+         * @brief Result of one benchmark
+         */
+        struct Result {
+            std::string name;
+            uint32_t ops;
+            double nsPerOp;
+            /**Negative if allocations are not counted*/
+            double allocsPerOp;
+        };
+
+        /**
+         * Gets the number of operator new calls so far, or 0 if the project
+         * was not built with LOUUI_BENCHMARK
+         */
+        static uint32_t getAllocations();
+
+        /**
+         * Gets whether allocations are counted
+         */
+        static bool countsAllocations();
+
+        /**
+         * Runs op ops times, after one untimed run
+         * @param name name of the benchmark
+         * @param ops number of timed runs
+         * @param op the operation, called with the index of the run
+         */
+        template <typename F>
+        static Result run(std::string name, uint32_t ops, F &&op) {
+            op(0u);
+            uint32_t allocations = getAllocations();
+            uint64_t start = pros::micros();
+            for(uint32_t i = 0; i < ops; i++) op(i);
+            uint64_t time = pros::micros() - start;
+            allocations = getAllocations() - allocations;
+            return {name, ops, (double)time * 1000 / ops,
+                    countsAllocations() ? (double)allocations / ops : -1};
+        }
+
+        /**
+         * Prints a result to the terminal
+         */
+        static void print(const Result &r);
+
+        /**
+         * Runs and prints the benchmarks of Chart::addData, Label::setText,
+         * Color construction, the ToggleButton style setters,
+         * DropDownMenu::setOptions and Display::getScreen. Widgets are
+         * created on a hidden object that is deleted afterwards.
+         * @param display display used for Display::getScreen
+         * @param screen name of an existing screen of the display
+         */
+        static std::vector<Result> runAll(Display &display,
+                                          const std::string &screen);
+    };
+}
+
+
+#endif //LOUUI_BENCHMARK_HPP
@@ -28,6 +28,8 @@
  */
 
 #include "Button.hpp"
+#include "Memory.hpp"
+#include "TouchInput.hpp"
 #include "../../include/display/lv_objx/lv_btn.h"
 
 lv_btn_state_t LouUI::Button::convertState(LouUI::Button::State s) {
@@ -39,12 +41,16 @@ lv_btn_state_t LouUI::Button::convertState(LouUI::Button::State s) {
 
 LouUI::Button::Button(lv_obj_t *parent) {
     obj = lv_btn_create(parent, nullptr);
+    lv_obj_set_free_ptr(obj, this);
 
-    releasedStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    releasedStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "Button",
+                                                 obj));
     lv_style_copy(releasedStyle, &lv_style_btn_rel);
-    pressedStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    pressedStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "Button",
+                                                obj));
     lv_style_copy(pressedStyle, &lv_style_btn_pr);
-    inactiveStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    inactiveStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "Button",
+                                                 obj));
     lv_style_copy(inactiveStyle, &lv_style_btn_ina);
 
     lv_btn_set_style(obj, LV_BTN_STYLE_REL, releasedStyle);
@@ -54,12 +60,20 @@ LouUI::Button::Button(lv_obj_t *parent) {
 
 LouUI::Button::Button(lv_obj_t *parent, LouUI::Button b) {
     obj = lv_btn_create(parent, b.getObj());
+    lv_obj_set_free_ptr(obj, this);
+    //lvgl copies the click action, which may be dispatch
+    callback = b.callback;
 
     releasedStyle = lv_btn_get_style(obj, LV_BTN_STYLE_REL);
     pressedStyle = lv_btn_get_style(obj, LV_BTN_STYLE_PR);
     inactiveStyle = lv_btn_get_style(obj, LV_BTN_STYLE_INA);
 }
 
+lv_res_t LouUI::Button::dispatch(lv_obj_t *btn) {
+    auto *b = (Button *)lv_obj_get_free_ptr(btn);
+    return b ? b->callback() : (lv_res_t)LV_RES_OK;
+}
+
 lv_obj_t *LouUI::Button::getObj() const {
     return obj;
 }
@@ -128,6 +142,12 @@ LouUI::Button *LouUI::Button::setAction(LouUI::Button::Action a) {
     return this;
 }
 
+LouUI::Button *LouUI::Button::setFastAction(LouUI::Button::Action a) {
+    lv_btn_set_action(obj, LV_BTN_ACTION_CLICK, nullptr);
+    TouchInput::addHandler(obj, nullptr, a);
+    return this;
+}
+
 LouUI::Button *
 LouUI::Button::setMainColor(LouUI::Color c, LouUI::Button::State s) {
     switch(s){
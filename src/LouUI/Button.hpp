@@ -33,6 +33,9 @@
 #include "../../include/display/lvgl.h"
 #include "Color.hpp"
 #include "Align.hpp"
+#include "InlineAction.hpp"
+#include <type_traits>
+#include <utility>
 
 namespace LouUI {
     /**
@@ -61,8 +64,12 @@ namespace LouUI {
         lv_style_t *pressedStyle;
         lv_style_t *inactiveStyle;
 
+        InlineAction callback;
+
         lv_btn_state_t convertState(State s);
 
+        static lv_res_t dispatch(lv_obj_t *btn);
+
     public:
 
         /**
@@ -159,6 +166,43 @@ namespace LouUI {
          */
         Button* setAction(Action a);
 
+        /**
+         * Sets an action to execute as soon as the button is released,
+         * without waiting for lvgl's next input read. Replaces any action set
+         * with setAction(Action a).
+         * @param a The function to be executed, with the same requirements
+         * as setAction(Action a)
+         * @see TouchInput
+         */
+        Button* setFastAction(Action a);
+
+        /**
+         * Sets a callable, such as a lambda with captures, to execute when
+         * the button is clicked. The callable is stored inside the button
+         * without heap allocation, so its captures must fit in
+         * InlineAction::SIZE bytes.
+         * @param f The callable to be executed. It takes no parameters and
+         * may return lv_res_t.
+         */
+        template <typename F, typename = typename std::enable_if<
+                !std::is_convertible<F, Action>::value>::type>
+        Button* setAction(F &&f) {
+            callback = InlineAction(std::forward<F>(f));
+            return setAction(dispatch);
+        }
+
+        /**
+         * Sets a callable to execute as soon as the button is released, with
+         * the same requirements as setAction(F &&f)
+         * @see setFastAction(Action a)
+         */
+        template <typename F, typename = typename std::enable_if<
+                !std::is_convertible<F, Action>::value>::type>
+        Button* setFastAction(F &&f) {
+            callback = InlineAction(std::forward<F>(f));
+            return setFastAction(dispatch);
+        }
+
         /**
          * Sets the main color of the button
          * @param s The button state to be modified. Use ALL to set for all
@@ -1,5 +1,7 @@
 #include "Chart.hpp"
+#include "Memory.hpp"
 #include <cstdlib>
+#include <stdexcept>
 #include "../../include/display/lv_core/lv_obj.h"
 #include "../../include/display/lv_objx/lv_chart.h"
 
@@ -13,7 +15,7 @@ lv_style_t *LouUI::Chart::getStyle() const {
 
 LouUI::Chart::Chart(lv_obj_t *parent) {
     obj = lv_chart_create(parent, nullptr);
-    style = (lv_style_t *)(std::malloc(sizeof(lv_style_t)));
+    style = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "Chart", obj));
     lv_style_copy(style, &lv_style_plain);
     lv_chart_set_style(obj, style);
 }
@@ -51,10 +53,26 @@ LouUI::Chart *LouUI::Chart::addSeries(std::string name, LouUI::Color c) {
 
 LouUI::Chart *LouUI::Chart::addData(std::string series, int16_t value) {
     lv_chart_series_t *s = getSeries(series);
+    if(decimation > 1){
+        Decimator &d = decimators[series];
+        if(d.count == 0 || std::abs(value - d.last) > std::abs(d.pick - d.last))
+            d.pick = value;
+        if(++d.count < decimation) return this;
+        value = d.pick;
+        d.last = value;
+        d.count = 0;
+    }
     lv_chart_set_next(obj, s, value);
     return this;
 }
 
+LouUI::Chart *LouUI::Chart::setDecimation(int factor) {
+    if(factor < 1) throw std::invalid_argument("Invalid decimation factor");
+    decimation = factor;
+    decimators.clear();
+    return this;
+}
+
 lv_chart_series_t *LouUI::Chart::getSeries(std::string name) {
     if(data.count(name)) return data[name];
     throw std::invalid_argument("Invalid series name");
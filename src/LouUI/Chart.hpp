@@ -44,6 +44,15 @@ namespace LouUI {
         lv_style_t *style;
         std::unordered_map<std::string, lv_chart_series_t*> data;
 
+        struct Decimator {
+            int16_t last = 0;
+            int16_t pick = 0;
+            int count = 0;
+        };
+
+        std::unordered_map<std::string, Decimator> decimators;
+        int decimation = 1;
+
     public:
 
         /**
@@ -89,6 +98,14 @@ namespace LouUI {
          */
         Chart *addData(std::string series, int16_t value);
 
+        /**
+         * Plots only one point for every factor data points added to a
+         * series. Of each group, the point furthest from the last plotted
+         * point is kept, so steps and overshoot stay visible.
+         * @param factor number of data points per plotted point (Default: 1)
+         */
+        Chart *setDecimation(int factor);
+
         /**
          * Set the amount of points for the chart. Affects all series in the
          * chart
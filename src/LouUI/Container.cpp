@@ -0,0 +1,249 @@
+/**
+ * @file Container.cpp
+ * @brief Container class that arranges its children in a row, column or grid
+ * @details Implementation file for the Container class, which measures its
+ * children once and places them in a single pass. The layout only runs again
+ * when a child's size changes.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Container.hpp"
+#include "Memory.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+    lv_coord_t crossOffset(LouUI::Container::CrossAlign a, lv_coord_t space,
+                           lv_coord_t size) {
+        if(a == LouUI::Container::CENTER) return (space - size) / 2;
+        if(a == LouUI::Container::END) return space - size;
+        return 0;
+    }
+}
+
+LouUI::Container::Container(lv_obj_t *parent) {
+    obj = lv_cont_create(parent, nullptr);
+    lv_cont_set_layout(obj, LV_LAYOUT_OFF);
+    lv_cont_set_fit(obj, false, false);
+
+    style = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "Container", obj));
+    lv_style_copy(style, &lv_style_transp);
+    lv_cont_set_style(obj, style);
+
+    //the signal function finds this container through the free pointer
+    lv_obj_set_free_ptr(obj, this);
+    ancestorSignal = lv_obj_get_signal_func(obj);
+    lv_obj_set_signal_func(obj, signal);
+}
+
+lv_obj_t *LouUI::Container::getObj() const {
+    return obj;
+}
+
+lv_style_t *LouUI::Container::getStyle() const {
+    return style;
+}
+
+LouUI::Container *LouUI::Container::addChild(lv_obj_t *child) {
+    children.push_back({child, lv_obj_get_width(child),
+                        lv_obj_get_height(child)});
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setType(Container::Type t) {
+    type = t;
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setColumns(int columns) {
+    if(columns > 0) this->columns = columns;
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setGap(int gap) {
+    this->gap = gap;
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setPadding(int padding) {
+    this->padding = padding;
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setCrossAlign(Container::CrossAlign a) {
+    crossAlign = a;
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setFit(bool fit) {
+    this->fit = fit;
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setSize(int width, int height) {
+    lv_obj_set_size(obj, width, height);
+    scheduleLayout();
+    return this;
+}
+
+LouUI::Container *LouUI::Container::setPosition(int x, int y) {
+    lv_obj_set_pos(obj, x, y);
+    return this;
+}
+
+LouUI::Container *
+LouUI::Container::align(lv_obj_t *ref, LouUI::Align alignType, int xShift,
+                        int yShift) {
+    lv_obj_align(obj, ref, (lv_align_t)alignType, xShift, yShift);
+    return this;
+}
+
+LouUI::Container *LouUI::Container::refresh() {
+    if(pending){
+        lv_task_del(pending);
+        pending = nullptr;
+    }
+    layout();
+    return this;
+}
+
+void LouUI::Container::scheduleLayout() {
+    if(pending) return;
+    //runs once at the next lv_task_handler, before the screen is refreshed
+    pending = lv_task_create(layoutTask, 0, LV_TASK_PRIO_HIGHEST, this);
+    lv_task_once(pending);
+}
+
+void LouUI::Container::layoutTask(void *param) {
+    auto *c = (Container *)param;
+    c->pending = nullptr;
+    c->layout();
+}
+
+void LouUI::Container::layout() {
+    //measure every child once
+    for(auto &c: children){
+        c.width = lv_obj_get_width(c.obj);
+        c.height = lv_obj_get_height(c.obj);
+    }
+
+    int cols = type == ROW ? std::max<int>(children.size(), 1)
+               : type == COLUMN ? 1 : columns;
+    int rows = (children.size() + cols - 1) / cols;
+
+    std::vector<lv_coord_t> colWidth(cols, 0);
+    std::vector<lv_coord_t> rowHeight(rows, 0);
+    for(size_t i = 0; i < children.size(); i++){
+        colWidth[i % cols] = std::max(colWidth[i % cols], children[i].width);
+        rowHeight[i / cols] = std::max(rowHeight[i / cols],
+                                       children[i].height);
+    }
+
+    lv_coord_t contentW = 0;
+    lv_coord_t contentH = 0;
+    for(auto w: colWidth) contentW += w;
+    for(auto h: rowHeight) contentH += h;
+    if(cols > 1) contentW += gap * (cols - 1);
+    if(rows > 1) contentH += gap * (rows - 1);
+
+    if(fit){
+        lv_obj_set_size(obj, contentW + 2 * padding, contentH + 2 * padding);
+    }
+
+    //a single row or column spans the whole container across its direction
+    if(type == ROW && rows == 1 && !fit){
+        rowHeight[0] = lv_obj_get_height(obj) - 2 * padding;
+    }else if(type == COLUMN && !fit){
+        std::fill(colWidth.begin(), colWidth.end(),
+                  lv_obj_get_width(obj) - 2 * padding);
+    }
+
+    //place every child in one pass
+    lv_coord_t y = padding;
+    for(int r = 0; r < rows; r++){
+        lv_coord_t x = padding;
+        for(int c = 0; c < cols; c++){
+            size_t i = r * cols + c;
+            if(i >= children.size()) break;
+            const Child &child = children[i];
+            lv_coord_t cx = x;
+            lv_coord_t cy = y;
+            //a row only aligns across, a column only aligns sideways
+            if(type != ROW){
+                cx += crossOffset(crossAlign, colWidth[c], child.width);
+            }
+            if(type != COLUMN){
+                cy += crossOffset(crossAlign, rowHeight[r], child.height);
+            }
+            lv_obj_set_pos(child.obj, cx, cy);
+            x += colWidth[c] + gap;
+        }
+        y += rowHeight[r] + gap;
+    }
+}
+
+lv_res_t LouUI::Container::signal(lv_obj_t *cont, lv_signal_t sign,
+                                  void *param) {
+    auto *c = (Container *)lv_obj_get_free_ptr(cont);
+    lv_res_t res = c->ancestorSignal(cont, sign, param);
+    if(res != LV_RES_OK) return res;
+
+    if(sign == LV_SIGNAL_CLEANUP){
+        if(c->pending) lv_task_del(c->pending);
+        c->pending = nullptr;
+    }else if(sign == LV_SIGNAL_CHILD_CHG){
+        if(param == nullptr){
+            //a child was deleted, forget the ones that are gone
+            auto gone = [cont](const Child &child){
+                for(lv_obj_t *o = lv_obj_get_child(cont, nullptr); o;
+                    o = lv_obj_get_child(cont, o)){
+                    if(o == child.obj) return false;
+                }
+                return true;
+            };
+            c->children.erase(std::remove_if(c->children.begin(),
+                                             c->children.end(), gone),
+                              c->children.end());
+            c->scheduleLayout();
+        }else{
+            //moving a child does nothing, resizing it relays out
+            for(auto &child: c->children){
+                if(child.obj != param) continue;
+                if(child.width != lv_obj_get_width(child.obj) ||
+                   child.height != lv_obj_get_height(child.obj)){
+                    c->scheduleLayout();
+                }
+                break;
+            }
+        }
+    }
+    return res;
+}
@@ -0,0 +1,200 @@
+/**
+ * @file Container.hpp
+ * @brief Container class that arranges its children in a row, column or grid
+ * @details Header file for the Container class, which measures its children
+ * once and places them in a single pass. The layout only runs again when a
+ * child's size changes.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_CONTAINER_HPP
+#define LOUUI_CONTAINER_HPP
+
+#include <vector>
+
+#include "../../include/display/lvgl.h"
+#include "../../include/display/lv_objx/lv_cont.h"
+#include "Align.hpp"
+
+namespace LouUI {
+    /**
+     * @class Container
+     * @brief Arranges objects in a row, column or grid
+     * @details
+     * A Container replaces chains of align calls. Objects are created with
+     * the container's obj as their parent and added with addChild(lv_obj_t
+     * *child); they are placed in the order they were added.
+     * @subsection usage Usage
+     * @code
+     * LouUI::Container *row = (new LouUI::Container(screen))
+     *         ->setType(LouUI::Container::ROW)
+     *         ->setGap(10)
+     *         ->setFit(true);
+     * for(int i = 0; i < 4; i++){
+     *     auto *b = (new LouUI::ToggleButton(row->getObj()))->setSize(100, 40);
+     *     row->addChild(b->getObj());
+     * }
+     * @endcode
+     * @subsection layoutPass Layout
+     * Changes are collected and laid out once, right before the next screen
+     * refresh. The sizes of the children are measured once per layout, and
+     * a child moving does not trigger a layout; only a change in its size
+     * does. Use refresh() if the positions are needed immediately.
+     */
+    class Container {
+    public:
+        /**
+         * @enum Type
+         * @brief How the children are arranged
+         */
+        enum Type{
+            /**Left to right (Default)*/
+            ROW,
+            /**Top to bottom*/
+            COLUMN,
+            /**Left to right, top to bottom, in a fixed number of columns*/
+            GRID
+        };
+
+        /**
+         * @enum CrossAlign
+         * @brief Where children sit across the direction of the layout, or
+         * inside their cell for grids
+         */
+        enum CrossAlign{
+            START,
+            CENTER,
+            END
+        };
+
+    private:
+        struct Child {
+            lv_obj_t *obj;
+            lv_coord_t width;
+            lv_coord_t height;
+        };
+
+        lv_obj_t *obj;
+        lv_style_t *style;
+        std::vector<Child> children;
+
+        Type type = ROW;
+        CrossAlign crossAlign = START;
+        int columns = 1;
+        int gap = 0;
+        int padding = 0;
+        bool fit = false;
+
+        lv_task_t *pending = nullptr;
+        lv_signal_func_t ancestorSignal;
+
+        void scheduleLayout();
+        void layout();
+
+        static lv_res_t signal(lv_obj_t *cont, lv_signal_t sign, void *param);
+        static void layoutTask(void *param);
+
+    public:
+
+        /**
+         * Creates a new container
+         * @param parent The object the container is created in
+         */
+        explicit Container(lv_obj_t *parent);
+
+        /**
+         * Getter for obj
+         */
+        lv_obj_t *getObj() const;
+
+        /**
+         * Getter for style
+         */
+        lv_style_t *getStyle() const;
+
+        /**
+         * Adds an object to the end of the layout
+         * @param child object created with getObj() as its parent
+         */
+        Container *addChild(lv_obj_t *child);
+
+        /**
+         * Sets how the children are arranged
+         */
+        Container *setType(Type t);
+
+        /**
+         * Sets the number of columns of a GRID
+         */
+        Container *setColumns(int columns);
+
+        /**
+         * Sets the space between children
+         */
+        Container *setGap(int gap);
+
+        /**
+         * Sets the space between the edge of the container and the children
+         */
+        Container *setPadding(int padding);
+
+        /**
+         * Sets where children sit across the direction of the layout
+         */
+        Container *setCrossAlign(CrossAlign a);
+
+        /**
+         * Sets whether the container resizes itself to fit its children
+         */
+        Container *setFit(bool fit);
+
+        /**
+         * Sets the size of the container
+         */
+        Container *setSize(int width, int height);
+
+        /**
+         * Sets the position of the container
+         */
+        Container *setPosition(int x, int y);
+
+        /**
+         * Aligns the container to another object
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift pixels to shift in the x-direction
+         * @param yShift pixels to shift in the y-direction
+         */
+        Container *align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                         int yShift = 0);
+
+        /**
+         * Lays out the children now instead of before the next refresh
+         */
+        Container *refresh();
+    };
+}
+
+
+#endif //LOUUI_CONTAINER_HPP
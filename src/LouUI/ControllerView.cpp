@@ -0,0 +1,130 @@
+/**
+ * @file ControllerView.cpp
+ * @brief Implementation of ControllerView
+ * @details Implements the ControllerView class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ControllerView.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+LouUI::ControllerView::ControllerView(pros::controller_id_e_t id)
+        : controller(id), nextRow(0) {
+    std::memset(shadow, ' ', sizeof(shadow));
+    //nothing is known to be on the screen, so every line is sent once
+    std::memset(sent, 0, sizeof(sent));
+    writer = new pros::Task(writeTask, this, TASK_PRIORITY_DEFAULT,
+                            TASK_STACK_DEPTH_DEFAULT, "LouUI controller");
+}
+
+void LouUI::ControllerView::writeTask(void *param) {
+    auto *view = (ControllerView *)param;
+    uint32_t now = pros::millis();
+    while(true){
+        //wait for the controller only after something was written
+        if(view->writeNext()) pros::Task::delay_until(&now, WRITE_PERIOD);
+        else{
+            pros::delay(10);
+            now = pros::millis();
+        }
+    }
+}
+
+bool LouUI::ControllerView::writeNext() {
+    char text[COLUMNS + 1];
+    int row = -1, first = 0, last = 0;
+
+    mutex.take(TIMEOUT_MAX);
+    for(int i = 0; i < ROWS && row < 0; i++){
+        int r = (nextRow + i) % ROWS;
+        for(int c = 0; c < COLUMNS; c++){
+            if(shadow[r][c] == sent[r][c]) continue;
+            if(row < 0){
+                row = r;
+                first = c;
+            }
+            last = c;
+        }
+    }
+    if(row >= 0){
+        std::memcpy(text, &shadow[row][first], last - first + 1);
+        text[last - first + 1] = '\0';
+    }
+    mutex.give();
+    if(row < 0) return false;
+
+    nextRow = (row + 1) % ROWS;
+    if(controller.set_text(row, first, text) != 1) return true;
+
+    //characters changed while sending still differ from the shadow
+    mutex.take(TIMEOUT_MAX);
+    std::memcpy(&sent[row][first], text, last - first + 1);
+    mutex.give();
+    return true;
+}
+
+LouUI::ControllerView *
+LouUI::ControllerView::setText(int row, int column, const std::string &text,
+                               int width) {
+    if(row < 0 || row >= ROWS || column < 0 || column >= COLUMNS){
+        throw std::invalid_argument("Position is not on the controller");
+    }
+    int length = std::max<int>(width, (int)text.size());
+    length = std::min(length, COLUMNS - column);
+
+    mutex.take(TIMEOUT_MAX);
+    for(int i = 0; i < length; i++){
+        shadow[row][column + i] = i < (int)text.size() ? text[i] : ' ';
+    }
+    mutex.give();
+    return this;
+}
+
+LouUI::ControllerView *LouUI::ControllerView::clearLine(int row) {
+    return setText(row, 0, "", COLUMNS);
+}
+
+LouUI::ControllerView *LouUI::ControllerView::clear() {
+    for(int row = 0; row < ROWS; row++) clearLine(row);
+    return this;
+}
+
+std::string LouUI::ControllerView::getLine(int row) {
+    if(row < 0 || row >= ROWS){
+        throw std::invalid_argument("Line is not on the controller");
+    }
+    mutex.take(TIMEOUT_MAX);
+    std::string line(shadow[row], COLUMNS);
+    mutex.give();
+    return line;
+}
+
+bool LouUI::ControllerView::isSynced() {
+    mutex.take(TIMEOUT_MAX);
+    bool synced = std::memcmp(shadow, sent, sizeof(shadow)) == 0;
+    mutex.give();
+    return synced;
+}
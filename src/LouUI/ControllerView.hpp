@@ -0,0 +1,127 @@
+/**
+ * @file ControllerView.hpp
+ * @brief ControllerView class
+ * @details Header file for the ControllerView class, which mirrors a shadow
+ * buffer of text to the controller screen
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_CONTROLLERVIEW_HPP
+#define LOUUI_CONTROLLERVIEW_HPP
+
+#include <string>
+
+#include "../../include/api.h"
+
+namespace LouUI {
+    /**
+     * @class ControllerView
+     * @brief Text on the controller screen
+     * @details
+     * The controller screen only accepts about one write every 50 ms, and
+     * writes sent faster than that are dropped. A ControllerView keeps a
+     * 3x15 shadow buffer that can be written at any rate from any task. A
+     * single writer task compares it with what was last sent, and every
+     * 50 ms sends the changed span of one line, going through the lines in
+     * turn so a line that changes constantly doesn't starve the others.
+     * A span is only marked as sent once the controller accepted it.
+     *
+     * Signal and Telemetry values can be bound to a span of a line, like
+     * they are bound to a Label.
+     * @subsection usage Usage
+     * @code
+     * LouUI::ControllerView *view = new LouUI::ControllerView();
+     * view->setText(0, 0, "Auton: Left");
+     * LouUI::Telemetry::bind("intake.temperature", view, 1, 0, "Temp %.0f");
+     * @endcode
+     */
+    class ControllerView {
+    public:
+        static constexpr int ROWS = 3;
+        static constexpr int COLUMNS = 15;
+        /**Time between writes to the controller, in milliseconds*/
+        static constexpr uint32_t WRITE_PERIOD = 50;
+
+    private:
+        pros::Controller controller;
+        pros::Mutex mutex;
+        pros::Task *writer;
+        char shadow[ROWS][COLUMNS];
+        char sent[ROWS][COLUMNS];
+        int nextRow;
+
+        static void writeTask(void *param);
+        bool writeNext();
+
+    public:
+
+        /**
+         * Constructor for ControllerView, which starts its writer task
+         *
+         * @param id The controller to write to
+         */
+        explicit ControllerView(
+                pros::controller_id_e_t id = pros::E_CONTROLLER_MASTER);
+
+        /**
+         * Writes text to the shadow buffer. Text past the end of the line
+         * is cut off
+         *
+         * @param row The line, 0 to 2
+         * @param column The first column, 0 to 14
+         * @param text The text
+         * @param width The number of columns the text owns, padded with
+         * spaces, or 0 for only the length of the text
+         */
+        ControllerView *setText(int row, int column, const std::string &text,
+                                int width = 0);
+
+        /**
+         * Clears a line of the shadow buffer
+         *
+         * @param row The line, 0 to 2
+         */
+        ControllerView *clearLine(int row);
+
+        /**
+         * Clears the shadow buffer
+         */
+        ControllerView *clear();
+
+        /**
+         * Gets a line of the shadow buffer
+         *
+         * @param row The line, 0 to 2
+         */
+        std::string getLine(int row);
+
+        /**
+         * Gets whether everything in the shadow buffer has been sent
+         */
+        bool isSynced();
+    };
+}
+
+
+#endif //LOUUI_CONTROLLERVIEW_HPP
@@ -29,6 +29,8 @@
 
 #include "Display.hpp"
 #include "Fonts.hpp"
+#include "Memory.hpp"
+#include <cstdio>
 
 
 LouUI::Display::Display() {
@@ -54,6 +56,7 @@ void LouUI::Display::addScreen(std::string name) {
     if(screens.count(name)) return;
     auto *newScreen = lv_tabview_add_tab(tabView, name.c_str());
     screens[name] = newScreen;
+    Memory::addScreen(newScreen, name);
 }
 
 void LouUI::Display::addScreens(const std::vector<std::string> &names) {
@@ -71,6 +74,49 @@ lv_obj_t *LouUI::Display::getScreen(const std::string &name) {
     throw std::invalid_argument("Invalid screen name");
 }
 
+void LouUI::Display::enableRenderStats() {
+    RenderStats::enable(tabView);
+}
+
+LouUI::RenderStats::Stats
+LouUI::Display::getRenderStats(const std::string &name) {
+    return RenderStats::get(getScreen(name));
+}
+
+void LouUI::Display::printRenderStats() {
+    for(const auto &screen : screens){
+        RenderStats::Stats s = RenderStats::get(screen.second);
+        std::printf("LouUI render %s: frames=%lu avg=%.2fms max=%lums "
+                    "px=%llu invalidated=%lu\n", screen.first.c_str(),
+                    (unsigned long)s.frames,
+                    s.frames ? (double)s.totalTime / s.frames : 0.0,
+                    (unsigned long)s.maxTime, (unsigned long long)s.pixels,
+                    (unsigned long)s.invalidations);
+    }
+}
+
+void LouUI::Display::setTransitionCache(bool enabled) {
+    if(enabled) TransitionCache::enable(tabView);
+    else TransitionCache::disable();
+}
+
+void LouUI::Display::setRefreshPolicy(LouUI::Governor::State state,
+                                      LouUI::Governor::Mode mode,
+                                      uint32_t period) {
+    Governor::setPolicy(state, mode, period);
+    Governor::enable();
+}
+
+void LouUI::Display::setGovernor(bool enabled) {
+    if(enabled) Governor::enable();
+    else Governor::disable();
+}
+
+void LouUI::Display::setMirror(bool enabled) {
+    if(enabled) ScreenMirror::enable();
+    else ScreenMirror::disable();
+}
+
 void LouUI::Display::initFonts() {
     //add symbols
 //    lv_font_add(&symbols_20, &dejavu_20);
@@ -36,6 +36,10 @@
 
 #include "../../include/display/lvgl.h"
 #include "Color.hpp"
+#include "Governor.hpp"
+#include "RenderStats.hpp"
+#include "ScreenMirror.hpp"
+#include "TransitionCache.hpp"
 
 namespace LouUI {
     class Display {
@@ -93,6 +97,64 @@ namespace LouUI {
          */
         lv_obj_t *getScreen(const std::string &name);
 
+        /**
+         * Starts recording the redraw time and the invalidated areas of
+         * each screen
+         * @see RenderStats
+         */
+        void enableRenderStats();
+
+        /**
+         * Gets the redraw totals of a screen
+         *
+         * @param name Name of the screen
+         */
+        RenderStats::Stats getRenderStats(const std::string &name);
+
+        /**
+         * Prints one line of redraw totals per screen to the terminal, e.g.
+         * to compare builds
+         */
+        void printRenderStats();
+
+        /**
+         * Draws the screens as cached images while the tabs slide, so a
+         * switch doesn't redraw every element of both screens each frame
+         *
+         * @param enabled Whether to use the cache
+         * @see TransitionCache
+         */
+        void setTransitionCache(bool enabled);
+
+        /**
+         * Sets how often lvgl may refresh the screen and read the touch
+         * screen in a competition state, and starts the governor that
+         * switches between the policies
+         *
+         * @param state The competition state
+         * @param mode How often lvgl may run
+         * @param period The period in milliseconds when throttled
+         * @see Governor
+         */
+        void setRefreshPolicy(Governor::State state, Governor::Mode mode,
+                              uint32_t period = 200);
+
+        /**
+         * Starts or stops the governor with its current policies
+         *
+         * @param enabled Whether lvgl is throttled while the robot runs
+         */
+        void setGovernor(bool enabled);
+
+        /**
+         * Streams the redrawn areas of the screen over the USB serial link,
+         * to be shown on a computer with tools/mirror.py
+         *
+         * @param enabled Whether to stream the screen
+         * @see ScreenMirror
+         */
+        void setMirror(bool enabled);
+
         void initFonts();
     };
 }
@@ -29,18 +29,22 @@
  */
 
 #include "DropDownMenu.hpp"
+#include "Memory.hpp"
 #include "../../include/display/lv_objx/lv_ddlist.h"
 #include "../../include/display/lvgl.h"
 
 LouUI::DropDownMenu::DropDownMenu(lv_obj_t *parent) {
     obj = lv_ddlist_create(parent, nullptr);
 
-    backgroundStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    backgroundStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                   "DropDownMenu", obj));
     lv_style_copy(backgroundStyle, &lv_style_pretty);
     backgroundStyle->text.font = &lv_font_dejavu_20;
-    selectedStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    selectedStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                 "DropDownMenu", obj));
     lv_style_copy(selectedStyle, &lv_style_plain_color);
-    scrollbarStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    scrollbarStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                  "DropDownMenu", obj));
     lv_style_copy(scrollbarStyle, &lv_style_plain_color);
 
     lv_ddlist_set_style(obj, LV_DDLIST_STYLE_BG, backgroundStyle);
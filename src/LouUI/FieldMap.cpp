@@ -0,0 +1,247 @@
+/**
+ * @file FieldMap.cpp
+ * @brief Implementation of FieldMap
+ * @details Implements the FieldMap class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "FieldMap.hpp"
+#include "Memory.hpp"
+#include "Pixels.hpp"
+#include "../../include/display/lv_core/lv_refr.h"
+#include "../../include/display/lv_objx/lv_line.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+LouUI::FieldMap::FieldMap(lv_obj_t *parent, int size) : size(size) {
+    obj = lv_canvas_create(parent, nullptr);
+    buffer = (lv_color_t *)(Memory::alloc(sizeof(lv_color_t) * size * size,
+                                          "FieldMap", obj));
+    lv_canvas_set_buffer(obj, buffer, size, size, LV_IMG_CF_TRUE_COLOR);
+    pathColor = Color("YELLOW").toLvColor();
+    drawBackground();
+
+    robotStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "FieldMap",
+                                              obj));
+    lv_style_copy(robotStyle, &lv_style_plain);
+    robotStyle->body.main_color = Color("RED").toLvColor();
+    robotStyle->body.grad_color = robotStyle->body.main_color;
+    robotStyle->body.border.color = Color("WHITE").toLvColor();
+    robotStyle->body.border.width = 1;
+    robot = lv_obj_create(obj, nullptr);
+    lv_obj_set_style(robot, robotStyle);
+    lv_obj_set_hidden(robot, true);
+
+    headingStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "FieldMap",
+                                                obj));
+    lv_style_copy(headingStyle, &lv_style_plain);
+    headingStyle->line.color = Color("WHITE").toLvColor();
+    headingStyle->line.width = 2;
+    heading = lv_line_create(robot, nullptr);
+    lv_line_set_style(heading, headingStyle);
+
+    setRobotSize(robotInches * okapi::inch);
+}
+
+void LouUI::FieldMap::drawBackground() {
+    if(image){
+        std::memcpy(buffer, image->data, sizeof(lv_color_t) * size * size);
+    }else{
+        lv_color_t field = Color(60, 60, 60).toLvColor();
+        lv_color_t seam = Color(90, 90, 90).toLvColor();
+        for(int y = 0; y < size; y++){
+            lv_color_t *row = buffer + y * size;
+            if((y * 6) % size < 6){
+                Pixels::fill(row, size, seam);
+                continue;
+            }
+            Pixels::fill(row, size, field);
+            for(int x = 0; x < size; x++){
+                if((x * 6) % size < 6) row[x] = seam;
+            }
+        }
+    }
+    lv_obj_invalidate(obj);
+}
+
+void LouUI::FieldMap::plot(lv_coord_t x, lv_coord_t y) {
+    int start = -(pathWidth - 1) / 2;
+    int left = std::max(x + start, 0);
+    int right = std::min(x + start + pathWidth, size);
+    if(left >= right) return;
+    for(int dy = start; dy < start + pathWidth; dy++){
+        if(y + dy < 0 || y + dy >= size) continue;
+        Pixels::fill(buffer + (y + dy) * size + left, right - left, pathColor);
+    }
+}
+
+void LouUI::FieldMap::drawSegment(lv_point_t from, lv_point_t to) {
+    //Bresenham's line, straight into the canvas buffer
+    int dx = std::abs(to.x - from.x);
+    int dy = -std::abs(to.y - from.y);
+    int sx = from.x < to.x ? 1 : -1;
+    int sy = from.y < to.y ? 1 : -1;
+    int err = dx + dy;
+    lv_coord_t x = from.x;
+    lv_coord_t y = from.y;
+    while(true){
+        plot(x, y);
+        if(x == to.x && y == to.y) break;
+        int e2 = 2 * err;
+        if(e2 >= dy){
+            err += dy;
+            x += sx;
+        }
+        if(e2 <= dx){
+            err += dx;
+            y += sy;
+        }
+    }
+
+    //only the segment is redrawn, not the whole canvas
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_area_t area;
+    area.x1 = coords.x1 + std::min(from.x, to.x) - pathWidth;
+    area.y1 = coords.y1 + std::min(from.y, to.y) - pathWidth;
+    area.x2 = coords.x1 + std::max(from.x, to.x) + pathWidth;
+    area.y2 = coords.y1 + std::max(from.y, to.y) + pathWidth;
+    lv_inv_area(&area);
+}
+
+lv_point_t LouUI::FieldMap::toPixels(double x, double y) const {
+    lv_point_t p;
+    p.x = (lv_coord_t)std::lround(x / fieldInches * size);
+    p.y = (lv_coord_t)(size - 1 - std::lround(y / fieldInches * size));
+    return p;
+}
+
+void LouUI::FieldMap::trackOdometry(void *param) {
+    auto *m = (FieldMap *)param;
+    m->setPose(m->odometry->getState(okapi::StateMode::CARTESIAN));
+}
+
+lv_obj_t *LouUI::FieldMap::getObj() const {
+    return obj;
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setImage(const lv_img_dsc_t *img) {
+    if(img->header.w != size || img->header.h != size ||
+       img->header.cf != LV_IMG_CF_TRUE_COLOR){
+        throw std::invalid_argument("Invalid field image");
+    }
+    image = img;
+    return clearPath();
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setFieldSize(okapi::QLength length) {
+    fieldInches = length.convert(okapi::inch);
+    setRobotSize(robotInches * okapi::inch);
+    return clearPath();
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setRobotSize(okapi::QLength length) {
+    robotInches = length.convert(okapi::inch);
+    auto s = (lv_coord_t)std::lround(robotInches / fieldInches * size);
+    lv_obj_set_size(robot, s, s);
+    return this;
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setRobotColor(LouUI::Color c) {
+    robotStyle->body.main_color = c.toLvColor();
+    robotStyle->body.grad_color = robotStyle->body.main_color;
+    lv_obj_refresh_style(robot);
+    return this;
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setPathColor(LouUI::Color c) {
+    pathColor = c.toLvColor();
+    return this;
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setPathWidth(int width) {
+    pathWidth = width;
+    return this;
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setPose(const okapi::OdomState &state) {
+    lv_point_t p = toPixels(state.x.convert(okapi::inch),
+                            state.y.convert(okapi::inch));
+    if(!hasPath){
+        hasPath = true;
+    }else if(p.x != last.x || p.y != last.y){
+        drawSegment(last, p);
+    }
+    last = p;
+
+    lv_coord_t s = lv_obj_get_width(robot);
+    lv_obj_set_pos(robot, p.x - s / 2, p.y - s / 2);
+
+    double theta = state.theta.convert(okapi::radian);
+    lv_point_t tip;
+    tip.x = (lv_coord_t)std::lround(s / 2 + std::sin(theta) * s / 2);
+    tip.y = (lv_coord_t)std::lround(s / 2 - std::cos(theta) * s / 2);
+    if(lv_obj_get_hidden(robot) || tip.x != headingPoints[1].x ||
+       tip.y != headingPoints[1].y){
+        headingPoints[0].x = s / 2;
+        headingPoints[0].y = s / 2;
+        headingPoints[1] = tip;
+        lv_line_set_points(heading, headingPoints, 2);
+    }
+    lv_obj_set_hidden(robot, false);
+    return this;
+}
+
+LouUI::FieldMap *
+LouUI::FieldMap::track(std::shared_ptr<okapi::Odometry> odom) {
+    odometry = odom;
+    if(odometry && !trackTask){
+        trackTask = lv_task_create(trackOdometry, 40, LV_TASK_PRIO_LOW, this);
+    }else if(!odometry && trackTask){
+        lv_task_del(trackTask);
+        trackTask = nullptr;
+    }
+    return this;
+}
+
+LouUI::FieldMap *LouUI::FieldMap::clearPath() {
+    hasPath = false;
+    drawBackground();
+    return this;
+}
+
+LouUI::FieldMap *LouUI::FieldMap::setPosition(int x, int y) {
+    lv_obj_set_pos(obj, x, y);
+    return this;
+}
+
+LouUI::FieldMap *
+LouUI::FieldMap::align(lv_obj_t *ref, LouUI::Align alignType, int xShift,
+                       int yShift) {
+    lv_obj_align(obj, ref, (lv_align_t)alignType, xShift, yShift);
+    return this;
+}
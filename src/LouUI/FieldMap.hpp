@@ -0,0 +1,173 @@
+/**
+ * @file FieldMap.hpp
+ * @brief Top-down field map showing the robot's odometry
+ * @details Contains the FieldMap class, which draws the pose from okapi
+ * odometry and the path the robot has traveled.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_FIELDMAP_HPP
+#define LOUUI_FIELDMAP_HPP
+
+#include "../../include/display/lvgl.h"
+#include "../../include/display/lv_objx/lv_canvas.h"
+#include "../../include/okapi/api/odometry/odometry.hpp"
+#include "Align.hpp"
+#include "Color.hpp"
+#include <memory>
+
+namespace LouUI {
+    /**
+     * @class FieldMap
+     * @brief Top-down view of the field with the robot and its path
+     * @details
+     * The field and the traveled path are drawn into an lv_canvas that keeps
+     * its pixels between frames. Each pose only adds the new path segment to
+     * the canvas, and only the pixels of that segment are redrawn, so the
+     * cost of a frame does not grow with the length of the path.
+     *
+     * The robot is a small object on top of the canvas, with a line showing
+     * its heading. Moving it only redraws its old and new bounding boxes.
+     *
+     * Poses use okapi's CARTESIAN mode: the origin is the bottom left corner
+     * of the field, +x is right, +y is up and 0 degrees points up.
+     * @subsection usage Usage
+     * @code
+     * auto *map = (new LouUI::FieldMap(lv_scr_act(), 240))
+     *         ->align(lv_scr_act(), LouUI::Align::CENTER)
+     *         ->track(chassis->getOdometry());
+     * @endcode
+     */
+    class FieldMap {
+
+    private:
+        lv_obj_t *obj;
+        lv_obj_t *robot;
+        lv_obj_t *heading;
+        lv_style_t *robotStyle;
+        lv_style_t *headingStyle;
+        lv_color_t *buffer;
+        int size;
+
+        const lv_img_dsc_t *image = nullptr;
+        double fieldInches = 144;
+        double robotInches = 18;
+        lv_color_t pathColor;
+        int pathWidth = 2;
+
+        bool hasPath = false;
+        lv_point_t last;
+        lv_point_t headingPoints[2];
+
+        std::shared_ptr<okapi::Odometry> odometry;
+        lv_task_t *trackTask = nullptr;
+
+        void drawBackground();
+        void plot(lv_coord_t x, lv_coord_t y);
+        void drawSegment(lv_point_t from, lv_point_t to);
+        lv_point_t toPixels(double x, double y) const;
+
+        static void trackOdometry(void *param);
+
+    public:
+
+        /**
+         * Creates a new field map
+         * @param parent The object the map is created in
+         * @param size The width and height of the map in pixels
+         */
+        explicit FieldMap(lv_obj_t *parent, int size = 240);
+
+        /**
+         * Getter for obj
+         */
+        lv_obj_t *getObj() const;
+
+        /**
+         * Draws an image of the field under the path, and clears the path.
+         * The image must be size by size pixels and in LV_IMG_CF_TRUE_COLOR
+         * format. By default, gray tiles are drawn.
+         */
+        FieldMap *setImage(const lv_img_dsc_t *img);
+
+        /**
+         * Sets the width of the field (Default: 12 feet)
+         */
+        FieldMap *setFieldSize(okapi::QLength length);
+
+        /**
+         * Sets the width of the robot (Default: 18 inches)
+         */
+        FieldMap *setRobotSize(okapi::QLength length);
+
+        /**
+         * Sets the color of the robot
+         */
+        FieldMap *setRobotColor(LouUI::Color c);
+
+        /**
+         * Sets the color of paths drawn after this call
+         */
+        FieldMap *setPathColor(LouUI::Color c);
+
+        /**
+         * Sets the width of paths drawn after this call, in pixels
+         */
+        FieldMap *setPathWidth(int width);
+
+        /**
+         * Moves the robot, extending the path from its last pose
+         * @param state The pose in okapi's CARTESIAN mode
+         */
+        FieldMap *setPose(const okapi::OdomState &state);
+
+        /**
+         * Follows an odometry's pose, reading it before each screen refresh
+         * @param odom The odometry to follow, or nullptr to stop following
+         */
+        FieldMap *track(std::shared_ptr<okapi::Odometry> odom);
+
+        /**
+         * Erases the path. The next pose starts a new path.
+         */
+        FieldMap *clearPath();
+
+        /**
+         * Sets the position of the map
+         */
+        FieldMap *setPosition(int x, int y);
+
+        /**
+         * Aligns the map to another object
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift x offset after alignment
+         * @param yShift y offset after alignment
+         */
+        FieldMap *align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                        int yShift = 0);
+    };
+}
+
+#endif //LOUUI_FIELDMAP_HPP
@@ -3,6 +3,11 @@
 
 #include "../../include/display/lvgl.h"
 
+/*
+ * Packed LouUI fonts. The sources in Fonts/ are generated from the full fonts
+ * in the top level fonts/ directory by `make fonts`.
+ */
+
 LV_FONT_DECLARE(symbols_20);
 
 LV_FONT_DECLARE(dejavu_20);
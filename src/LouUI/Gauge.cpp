@@ -27,6 +27,7 @@
  */
 
 #include "Gauge.hpp"
+#include "Memory.hpp"
 #include "../../include/display/lv_core/lv_obj.h"
 #include "../../include/display/lv_objx/lv_gauge.h"
 
@@ -40,9 +41,10 @@ lv_style_t *LouUI::Gauge::getStyle() const {
 
 LouUI::Gauge::Gauge(lv_obj_t *parent) {
     obj = lv_gauge_create(parent, nullptr);
-    style = (lv_style_t *)(std::malloc(sizeof(lv_style_t)));
+    style = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "Gauge", obj));
     lv_style_copy(style, &lv_style_pretty_color);
     needles[0] = LV_COLOR_RED;
+    lv_gauge_set_needle_count(obj, 1, needles);
 }
 
 LouUI::Gauge::Gauge(lv_obj_t *parent, LouUI::Gauge g) {
@@ -55,6 +57,11 @@ LouUI::Gauge *LouUI::Gauge::setScale(int angle, int lineCnt, int labelCnt) {
     return this;
 }
 
+LouUI::Gauge *LouUI::Gauge::setValue(int value) {
+    lv_gauge_set_value(obj, 0, value);
+    return this;
+}
+
 LouUI::Gauge *LouUI::Gauge::setRange(int min, int max) {
     lv_gauge_set_range(obj, min, max);
     return this;
@@ -56,6 +56,8 @@ namespace LouUI {
 
         Gauge *setRange(int min, int max);
 
+        Gauge *setValue(int value);
+
         Gauge *setCriticalValue(int value);
 
         Gauge *setStartColor(LouUI::Color c);
@@ -0,0 +1,107 @@
+/**
+ * @file Governor.cpp
+ * @brief Implementation of Governor
+ * @details Implements the Governor class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Governor.hpp"
+
+LouUI::Governor::Policy LouUI::Governor::policies[3] = {
+        {Mode::FULL, 0},
+        {Mode::THROTTLED, 250},
+        {Mode::ON_CHANGE, 100}
+};
+std::atomic<bool> LouUI::Governor::dirty{true};
+pros::Task *LouUI::Governor::task = nullptr;
+std::atomic<bool> LouUI::Governor::running{false};
+
+LouUI::Governor::State LouUI::Governor::getState() {
+    uint8_t status = pros::competition::get_status();
+    if(status & COMPETITION_DISABLED) return State::DISABLED;
+    if(status & COMPETITION_AUTONOMOUS) return State::AUTONOMOUS;
+    return State::OPCONTROL;
+}
+
+void LouUI::Governor::run(void *param) {
+    uint32_t opened = pros::millis();
+    bool enabled = true;
+    int32_t releaseCount = pros::screen::touch_status().release_count;
+    while(true){
+        //the lvgl input read runs in a paused task too, so a touch must
+        //open a window until lvgl has seen the release
+        pros::screen_touch_status_s_t touch = pros::screen::touch_status();
+        if(touch.touch_status == pros::E_TOUCH_PRESSED ||
+           touch.touch_status == pros::E_TOUCH_HELD ||
+           touch.release_count != releaseCount){
+            releaseCount = touch.release_count;
+            markDirty();
+        }
+
+        Policy policy = policies[(int)getState()];
+        if(!running) policy = {Mode::FULL, 0};
+        uint32_t now = pros::millis();
+
+        bool open = policy.mode == Mode::FULL;
+        if(!open && now - opened >= policy.period){
+            open = policy.mode == Mode::THROTTLED || dirty.exchange(false);
+        }
+
+        //lvgl runs overdue tasks as soon as it is enabled again
+        if(open){
+            if(policy.mode != Mode::FULL) opened = now;
+            if(!enabled) lv_task_enable(true);
+            enabled = true;
+        }else if(enabled && now - opened >= WINDOW){
+            lv_task_enable(false);
+            enabled = false;
+        }
+        pros::delay(CHECK_PERIOD);
+    }
+}
+
+void LouUI::Governor::enable() {
+    running = true;
+    if(task) return;
+    task = new pros::Task(run, nullptr, TASK_PRIORITY_DEFAULT,
+                          TASK_STACK_DEPTH_MIN, "LouUI governor");
+}
+
+void LouUI::Governor::disable() {
+    //the task enables lvgl again in its next check
+    running = false;
+}
+
+void LouUI::Governor::setPolicy(LouUI::Governor::State state,
+                                LouUI::Governor::Mode mode, uint32_t period) {
+    policies[(int)state] = {mode, period};
+}
+
+LouUI::Governor::Mode LouUI::Governor::getMode() {
+    return policies[(int)getState()].mode;
+}
+
+void LouUI::Governor::markDirty() {
+    dirty.store(true, std::memory_order_relaxed);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file Governor.hpp
+ * @brief Governor class
+ * @details Header file for the Governor class, which lowers the rate of the
+ * lvgl refresh and input tasks depending on the competition state
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_GOVERNOR_HPP
+#define LOUUI_GOVERNOR_HPP
+
+#include <atomic>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+
+namespace LouUI {
+    /**
+     * @class Governor
+     * @brief Lowers the UI frame rate while the robot is running
+     * @details
+     * The lvgl refresh and input tasks are created by the PROS kernel with
+     * fixed periods (LV_REFR_PERIOD and LV_INDEV_READ_PERIOD), and compete
+     * with the control loops for the CPU. The Governor runs a task that
+     * checks the competition state every few milliseconds and applies the
+     * policy set for it. When throttled, it pauses every lvgl task with
+     * lv_task_enable() and opens a short window once per period, in which
+     * overdue tasks (the refresh, the input read and LouUI's own tasks) run
+     * once. While the screen is touched, every window is opened, even in
+     * ON_CHANGE mode, so presses are never ignored.
+     *
+     * Usually used through Display::setRefreshPolicy().
+     */
+    class Governor {
+    public:
+
+        /**
+         * @enum State
+         * @brief Competition states a policy can be set for
+         */
+        enum class State {
+            /**Disabled, including competition_initialize*/
+            DISABLED,
+            AUTONOMOUS,
+            OPCONTROL
+        };
+
+        /**
+         * @enum Mode
+         * @brief How often lvgl may run
+         */
+        enum class Mode {
+            /**lvgl runs at its own rate*/
+            FULL,
+            /**lvgl runs once per period*/
+            THROTTLED,
+            /**lvgl runs once per period, but only if something is dirty*/
+            ON_CHANGE
+        };
+
+    private:
+        struct Policy {
+            Mode mode;
+            uint32_t period;
+        };
+
+        /**Time lvgl is allowed to run each period, in milliseconds*/
+        static constexpr uint32_t WINDOW = 10;
+        /**How often the competition state is checked, in milliseconds*/
+        static constexpr uint32_t CHECK_PERIOD = 5;
+
+        static Policy policies[3];
+        static std::atomic<bool> dirty;
+        static pros::Task *task;
+        static std::atomic<bool> running;
+
+        static State getState();
+        static void run(void *param);
+
+    public:
+
+        /**
+         * Starts the governor. The default policy runs lvgl at full rate
+         * while disabled, every 250 ms in autonomous and on change in
+         * driver control, at most every 100 ms
+         */
+        static void enable();
+
+        /**
+         * Stops the governor and lets lvgl run at full rate
+         */
+        static void disable();
+
+        /**
+         * Sets the policy for a competition state
+         *
+         * @param state The competition state
+         * @param mode How often lvgl may run
+         * @param period The period in milliseconds when throttled
+         */
+        static void setPolicy(State state, Mode mode, uint32_t period = 200);
+
+        /**
+         * Gets the mode for the current competition state
+         */
+        static Mode getMode();
+
+        /**
+         * Marks the UI as changed, so lvgl runs in the next window in
+         * ON_CHANGE mode. Called by Signal, and by Telemetry when a bound
+         * channel changes
+         */
+        static void markDirty();
+    };
+}
+
+
+#endif //LOUUI_GOVERNOR_HPP
@@ -0,0 +1,161 @@
+/**
+ * @file Heatmap.cpp
+ * @brief Implementation of Heatmap
+ * @details Implements the Heatmap class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Heatmap.hpp"
+#include "Memory.hpp"
+#include "Pixels.hpp"
+#include "../../include/display/lv_core/lv_refr.h"
+#include <algorithm>
+#include <stdexcept>
+
+LouUI::Heatmap::Heatmap(lv_obj_t *parent, int rows, int columns,
+                        int cellSize)
+        : rows(rows), columns(columns), cellSize(cellSize), min(0), max(100),
+          values(rows * columns, 0), indices(rows * columns, 0),
+          shown(rows * columns, 0), repaint(true) {
+    if(rows < 1 || columns < 1 || cellSize < 2){
+        throw std::invalid_argument("Heatmap needs cells");
+    }
+    int width = columns * cellSize;
+    int height = rows * cellSize;
+    obj = lv_canvas_create(parent, nullptr);
+    buffer = (lv_color_t *)(Memory::alloc(sizeof(lv_color_t) * width *
+                                          height, "Heatmap", obj));
+    lv_canvas_set_buffer(obj, buffer, width, height, LV_IMG_CF_TRUE_COLOR);
+    //the gaps between the cells are never painted again
+    Pixels::fill(buffer, width * height, Color(20, 20, 20).toLvColor());
+
+    setGradient({Color("BLUE"), Color("GREEN"), Color("YELLOW"),
+                 Color("RED")});
+    updater = lv_task_create(update, 100, LV_TASK_PRIO_MID, this);
+}
+
+LouUI::Heatmap::~Heatmap() {
+    //the canvas draws from the buffer, so it goes first
+    lv_task_del(updater);
+    lv_obj_del(obj);
+    Memory::free(buffer);
+}
+
+void LouUI::Heatmap::paint(int cell, lv_color_t color) {
+    int width = columns * cellSize;
+    int x = (cell % columns) * cellSize;
+    int y = (cell / columns) * cellSize;
+    for(int row = y; row < y + cellSize - 1; row++){
+        Pixels::fill(buffer + row * width + x, cellSize - 1, color);
+    }
+
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    area.x1 += x;
+    area.y1 += y;
+    area.x2 = area.x1 + cellSize - 2;
+    area.y2 = area.y1 + cellSize - 2;
+    lv_inv_area(&area);
+}
+
+void LouUI::Heatmap::update(void *param) {
+    auto *map = (Heatmap *)param;
+    float range = map->max - map->min;
+    Pixels::quantize(map->values.data(), map->indices.data(),
+                     map->values.size(), map->min,
+                     range != 0 ? 255 / range : 0);
+    for(size_t i = 0; i < map->indices.size(); i++){
+        if(!map->repaint && map->indices[i] == map->shown[i]) continue;
+        map->paint(i, map->table[map->indices[i]]);
+        map->shown[i] = map->indices[i];
+    }
+    map->repaint = false;
+}
+
+LouUI::Heatmap *LouUI::Heatmap::set(int row, int column, float value) {
+    if(row < 0 || row >= rows || column < 0 || column >= columns){
+        throw std::invalid_argument("Cell does not exist");
+    }
+    values[row * columns + column] = value;
+    return this;
+}
+
+LouUI::Heatmap *
+LouUI::Heatmap::setRow(int row, const std::vector<float> &rowValues) {
+    if(row < 0 || row >= rows || (int)rowValues.size() != columns){
+        throw std::invalid_argument("Row does not match the heatmap");
+    }
+    std::copy(rowValues.begin(), rowValues.end(),
+              values.begin() + row * columns);
+    return this;
+}
+
+float LouUI::Heatmap::get(int row, int column) {
+    if(row < 0 || row >= rows || column < 0 || column >= columns){
+        throw std::invalid_argument("Cell does not exist");
+    }
+    return values[row * columns + column];
+}
+
+LouUI::Heatmap *LouUI::Heatmap::setRange(float min, float max) {
+    Heatmap::min = min;
+    Heatmap::max = max;
+    return this;
+}
+
+LouUI::Heatmap *
+LouUI::Heatmap::setGradient(std::vector<LouUI::Color> colors) {
+    if(colors.empty()) throw std::invalid_argument("Gradient needs a color");
+    std::vector<lv_color_t> stops;
+    for(Color &c : colors) stops.push_back(c.toLvColor());
+    for(int i = 0; i < 256; i++){
+        if(stops.size() == 1){
+            table[i] = stops[0];
+            continue;
+        }
+        //position between the two surrounding colors, in 1/255 steps
+        int scaled = i * (stops.size() - 1);
+        int stop = std::min<int>(scaled / 255, stops.size() - 2);
+        int mix = scaled - stop * 255;
+        table[i] = lv_color_mix(stops[stop + 1], stops[stop], mix);
+    }
+    repaint = true;
+    return this;
+}
+
+LouUI::Heatmap *LouUI::Heatmap::setPosition(int x, int y) {
+    lv_obj_set_pos(obj, x, y);
+    return this;
+}
+
+LouUI::Heatmap *
+LouUI::Heatmap::align(lv_obj_t *ref, LouUI::Align alignType, int xShift,
+                      int yShift) {
+    lv_obj_align(obj, ref, alignType, xShift, yShift);
+    return this;
+}
+
+lv_obj_t *LouUI::Heatmap::getObj() {
+    return obj;
+}
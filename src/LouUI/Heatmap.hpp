@@ -0,0 +1,142 @@
+/**
+ * @file Heatmap.hpp
+ * @brief Heatmap class
+ * @details Header file for the Heatmap class, which draws a matrix of values as
+ * colored cells on a canvas
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_HEATMAP_HPP
+#define LOUUI_HEATMAP_HPP
+
+#include <string>
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+#include "Align.hpp"
+#include "Color.hpp"
+
+namespace LouUI {
+    /**
+     * @class Heatmap
+     * @brief A matrix of values drawn as colored cells
+     * @details
+     * Values are mapped through a 256 entry color table, built once from a
+     * gradient, and painted into a canvas buffer the Heatmap owns. set()
+     * only stores the value, so it can be called from any task. Ten times
+     * a second an lvgl task converts every value to a table index with the
+     * vectorized Pixels::quantize(), and repaints and invalidates only the
+     * cells whose index changed.
+     * @subsection usage Usage
+     * @code
+     * //rows of motors, columns of temperature and current
+     * LouUI::Heatmap *drive = (new LouUI::Heatmap(screen, 6, 2, 24))
+     *         ->setRange(20, 70);
+     * drive->set(0, 0, leftFront.get_temperature());
+     * @endcode
+     */
+    class Heatmap {
+    private:
+        lv_obj_t *obj;
+        lv_color_t *buffer;
+        lv_task_t *updater;
+        lv_color_t table[256];
+
+        int rows;
+        int columns;
+        int cellSize;
+        float min;
+        float max;
+        std::vector<float> values;
+        std::vector<uint8_t> indices;
+        std::vector<uint8_t> shown;
+        bool repaint;
+
+        void paint(int cell, lv_color_t color);
+        static void update(void *param);
+
+    public:
+
+        /**
+         * Creates a new heatmap with every value at the bottom of the range
+         * @param parent The object the heatmap is created in
+         * @param rows The number of rows
+         * @param columns The number of columns
+         * @param cellSize The width and height of each cell in pixels,
+         * including a one pixel gap
+         */
+        Heatmap(lv_obj_t *parent, int rows, int columns, int cellSize = 20);
+
+        /**
+         * Deletes the canvas and frees its buffer
+         */
+        ~Heatmap();
+
+        /**
+         * Sets the value of a cell. Safe to call from any task
+         */
+        Heatmap* set(int row, int column, float value);
+
+        /**
+         * Sets every value of a row. Safe to call from any task
+         */
+        Heatmap* setRow(int row, const std::vector<float> &rowValues);
+
+        /**
+         * Gets the value of a cell
+         */
+        float get(int row, int column);
+
+        /**
+         * Sets the values at the two ends of the gradient. Values outside
+         * the range get the end colors
+         */
+        Heatmap* setRange(float min, float max);
+
+        /**
+         * Sets the gradient the values are colored with, as evenly spaced
+         * colors from the bottom of the range to the top. The default goes
+         * from blue through green and yellow to red
+         */
+        Heatmap* setGradient(std::vector<LouUI::Color> colors);
+
+        Heatmap* setPosition(int x, int y);
+
+        /**
+         * Aligns the heatmap
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift pixels to shift in the x-direction
+         * @param yShift pixels to shift in the y-direction
+         */
+        Heatmap* align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                       int yShift = 0);
+
+        lv_obj_t *getObj();
+    };
+}
+
+
+#endif //LOUUI_HEATMAP_HPP
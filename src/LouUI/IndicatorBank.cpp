@@ -0,0 +1,217 @@
+/**
+ * @file IndicatorBank.cpp
+ * @brief Implementation of IndicatorBank
+ * @details Implements the IndicatorBank class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "IndicatorBank.hpp"
+#include "Memory.hpp"
+#include "../../include/display/lv_draw/lv_draw_label.h"
+#include "../../include/display/lv_draw/lv_draw_rect.h"
+#include <stdexcept>
+
+lv_design_func_t LouUI::IndicatorBank::ancestorDesign = nullptr;
+
+LouUI::IndicatorBank::IndicatorBank(lv_obj_t *parent, int count, int columns)
+        : count(count), columns(columns), ledSize(16), drawn(0) {
+    if(count < 1 || count > MAX_LEDS || columns < 1){
+        throw std::invalid_argument("IndicatorBank needs 1 to 32 LEDs");
+    }
+    obj = lv_obj_create(parent, nullptr);
+    lv_obj_set_free_ptr(obj, this);
+    lv_obj_set_style(obj, &lv_style_transp);
+    lv_obj_set_size(obj, columns * 50, (count + columns - 1) / columns * 24);
+    if(!ancestorDesign) ancestorDesign = lv_obj_get_design_func(obj);
+    lv_obj_set_design_func(obj, design);
+
+    offStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                            "IndicatorBank", obj));
+    lv_style_copy(offStyle, &lv_style_plain);
+    offStyle->body.radius = LV_RADIUS_CIRCLE;
+    offStyle->body.main_color = Color(40, 40, 40).toLvColor();
+    offStyle->body.grad_color = Color(40, 40, 40).toLvColor();
+    offStyle->body.border.color = Color(90, 90, 90).toLvColor();
+    offStyle->body.border.width = 1;
+
+    onStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                           "IndicatorBank", obj));
+    lv_style_copy(onStyle, offStyle);
+    onStyle->body.main_color = Color(0, 220, 0).toLvColor();
+    onStyle->body.grad_color = Color(0, 220, 0).toLvColor();
+
+    labelStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                              "IndicatorBank", obj));
+    lv_style_copy(labelStyle, &lv_style_plain);
+    labelStyle->text.color = Color("WHITE").toLvColor();
+
+    updater = lv_task_create(update, 40, LV_TASK_PRIO_MID, this);
+}
+
+LouUI::IndicatorBank::~IndicatorBank() {
+    //the object's design function reads this bank through its free_ptr,
+    //so the object cannot outlive it
+    lv_task_del(updater);
+    lv_obj_del(obj);
+    Memory::free(offStyle);
+    Memory::free(onStyle);
+    Memory::free(labelStyle);
+}
+
+lv_area_t LouUI::IndicatorBank::getCell(int index) {
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    int rows = (count + columns - 1) / columns;
+    lv_coord_t w = lv_area_get_width(&coords) / columns;
+    lv_coord_t h = lv_area_get_height(&coords) / rows;
+    lv_area_t cell;
+    cell.x1 = coords.x1 + (index % columns) * w;
+    cell.y1 = coords.y1 + (index / columns) * h;
+    cell.x2 = cell.x1 + w - 1;
+    cell.y2 = cell.y1 + h - 1;
+    return cell;
+}
+
+lv_area_t LouUI::IndicatorBank::getLed(int index) {
+    lv_area_t cell = getCell(index);
+    lv_area_t led;
+    led.x1 = cell.x1;
+    led.y1 = cell.y1 + (lv_area_get_height(&cell) - ledSize) / 2;
+    led.x2 = led.x1 + ledSize - 1;
+    led.y2 = led.y1 + ledSize - 1;
+    return led;
+}
+
+bool LouUI::IndicatorBank::design(lv_obj_t *obj, const lv_area_t *clipMask,
+                                  lv_design_mode_t mode) {
+    if(mode != LV_DESIGN_DRAW_MAIN) return ancestorDesign(obj, clipMask, mode);
+    ancestorDesign(obj, clipMask, mode);
+
+    auto *bank = (IndicatorBank *)lv_obj_get_free_ptr(obj);
+    lv_area_t clip;
+    for(int i = 0; i < bank->count; i++){
+        //only the LEDs that were invalidated are drawn
+        lv_area_t led = bank->getLed(i);
+        if(lv_area_intersect(&clip, &led, clipMask)){
+            bool on = (bank->drawn >> i) & 1;
+            lv_draw_rect(&led, clipMask, on ? bank->onStyle : bank->offStyle,
+                         LV_OPA_COVER);
+        }
+        if(i >= (int)bank->labels.size()) continue;
+        lv_area_t text = bank->getCell(i);
+        text.x1 = led.x2 + 4;
+        text.y1 = led.y1 + (bank->ledSize -
+                  lv_font_get_height(bank->labelStyle->text.font)) / 2;
+        if(lv_area_intersect(&clip, &text, clipMask)){
+            lv_draw_label(&text, clipMask, bank->labelStyle, LV_OPA_COVER,
+                          bank->labels[i].c_str(), LV_TXT_FLAG_NONE, nullptr);
+        }
+    }
+    return true;
+}
+
+void LouUI::IndicatorBank::update(void *param) {
+    auto *bank = (IndicatorBank *)param;
+    uint32_t bits = bank->mask.load(std::memory_order_relaxed);
+    uint32_t flipped = bits ^ bank->drawn;
+    bank->drawn = bits;
+    for(int i = 0; flipped; i++, flipped >>= 1){
+        if(!(flipped & 1)) continue;
+        lv_area_t led = bank->getLed(i);
+        lv_inv_area(&led);
+    }
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::set(uint32_t bits) {
+    if(count < MAX_LEDS) bits &= (1u << count) - 1;
+    mask.store(bits, std::memory_order_relaxed);
+    return this;
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::set(int index, bool on) {
+    if(index < 0 || index >= count){
+        throw std::invalid_argument("LED does not exist");
+    }
+    if(on) mask.fetch_or(1u << index, std::memory_order_relaxed);
+    else mask.fetch_and(~(1u << index), std::memory_order_relaxed);
+    return this;
+}
+
+uint32_t LouUI::IndicatorBank::get() {
+    return mask.load(std::memory_order_relaxed);
+}
+
+LouUI::IndicatorBank *
+LouUI::IndicatorBank::setLabels(std::vector<std::string> labels) {
+    IndicatorBank::labels = std::move(labels);
+    lv_obj_invalidate(obj);
+    return this;
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::setLedSize(int size) {
+    ledSize = size;
+    lv_obj_invalidate(obj);
+    return this;
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::setOnColor(LouUI::Color c) {
+    onStyle->body.main_color = c.toLvColor();
+    onStyle->body.grad_color = c.toLvColor();
+    lv_obj_invalidate(obj);
+    return this;
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::setOffColor(LouUI::Color c) {
+    offStyle->body.main_color = c.toLvColor();
+    offStyle->body.grad_color = c.toLvColor();
+    lv_obj_invalidate(obj);
+    return this;
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::setTextColor(LouUI::Color c) {
+    labelStyle->text.color = c.toLvColor();
+    lv_obj_invalidate(obj);
+    return this;
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::setSize(int width, int height) {
+    lv_obj_set_size(obj, width, height);
+    return this;
+}
+
+LouUI::IndicatorBank *LouUI::IndicatorBank::setPosition(int x, int y) {
+    lv_obj_set_pos(obj, x, y);
+    return this;
+}
+
+LouUI::IndicatorBank *
+LouUI::IndicatorBank::align(lv_obj_t *ref, LouUI::Align alignType,
+                            int xShift, int yShift) {
+    lv_obj_align(obj, ref, alignType, xShift, yShift);
+    return this;
+}
+
+lv_obj_t *LouUI::IndicatorBank::getObj() {
+    return obj;
+}
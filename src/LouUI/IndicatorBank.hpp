@@ -0,0 +1,163 @@
+/**
+ * @file IndicatorBank.hpp
+ * @brief IndicatorBank class
+ * @details Header file for the IndicatorBank class, a panel of LEDs for boolean
+ * states that is updated with a bitmask
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_INDICATORBANK_HPP
+#define LOUUI_INDICATORBANK_HPP
+
+#include <atomic>
+#include <bitset>
+#include <string>
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+#include "Align.hpp"
+#include "Color.hpp"
+
+namespace LouUI {
+    /**
+     * @class IndicatorBank
+     * @brief A panel of up to 32 LEDs, set with a bitmask
+     * @details
+     * All LEDs are drawn by one lvgl object with one design function and
+     * two shared styles, one for on and one for off. set() only stores the
+     * mask, so it can be called from any task at any rate. An lvgl task
+     * compares the stored mask with the one last drawn and invalidates
+     * only the LEDs whose bit flipped, so setting the same mask every loop
+     * redraws nothing.
+     * @subsection usage Usage
+     * @code
+     * LouUI::IndicatorBank *limits = (new LouUI::IndicatorBank(screen, 8, 4))
+     *         ->setLabels({"A", "B", "C", "D", "E", "F", "G", "H"})
+     *         ->setSize(200, 60);
+     * //in a loop
+     * limits->set(pros::c::adi_digital_read('A') | ...);
+     * @endcode
+     */
+    class IndicatorBank {
+    public:
+        static constexpr int MAX_LEDS = 32;
+
+    private:
+        lv_obj_t *obj;
+        lv_style_t *onStyle;
+        lv_style_t *offStyle;
+        lv_style_t *labelStyle;
+        lv_task_t *updater;
+
+        int count;
+        int columns;
+        int ledSize;
+        std::vector<std::string> labels;
+        std::atomic<uint32_t> mask{0};
+        uint32_t drawn;
+
+        static lv_design_func_t ancestorDesign;
+
+        lv_area_t getCell(int index);
+        lv_area_t getLed(int index);
+        static bool design(lv_obj_t *obj, const lv_area_t *clipMask,
+                           lv_design_mode_t mode);
+        static void update(void *param);
+
+    public:
+
+        /**
+         * Creates a new indicator bank with every LED off
+         * @param parent The object the bank is created in
+         * @param count The number of LEDs, up to 32
+         * @param columns The number of LEDs in each row
+         */
+        IndicatorBank(lv_obj_t *parent, int count, int columns = 8);
+
+        /**
+         * Deletes the object and frees its styles
+         */
+        ~IndicatorBank();
+
+        /**
+         * Sets every LED, bit i for LED i. Safe to call from any task
+         */
+        IndicatorBank* set(uint32_t bits);
+
+        /**
+         * Sets every LED, bit i for LED i. Safe to call from any task
+         */
+        template <std::size_t N>
+        IndicatorBank* set(const std::bitset<N> &bits) {
+            static_assert(N <= MAX_LEDS, "IndicatorBank has at most 32 LEDs");
+            return set((uint32_t)bits.to_ulong());
+        }
+
+        /**
+         * Sets one LED. Safe to call from any task
+         */
+        IndicatorBank* set(int index, bool on);
+
+        /**
+         * Gets the mask that was last set
+         */
+        uint32_t get();
+
+        /**
+         * Sets the text next to each LED
+         */
+        IndicatorBank* setLabels(std::vector<std::string> labels);
+
+        /**
+         * Sets the diameter of the LEDs
+         */
+        IndicatorBank* setLedSize(int size);
+
+        IndicatorBank* setOnColor(LouUI::Color c);
+
+        IndicatorBank* setOffColor(LouUI::Color c);
+
+        IndicatorBank* setTextColor(LouUI::Color c);
+
+        IndicatorBank* setSize(int width, int height);
+
+        IndicatorBank* setPosition(int x, int y);
+
+        /**
+         * Aligns the bank
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift pixels to shift in the x-direction
+         * @param yShift pixels to shift in the y-direction
+         */
+        IndicatorBank* align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                             int yShift = 0);
+
+        lv_obj_t *getObj();
+    };
+}
+
+
+#endif //LOUUI_INDICATORBANK_HPP
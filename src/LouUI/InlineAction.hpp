@@ -0,0 +1,161 @@
+/**
+ * @file InlineAction.hpp
+ * @brief Fixed-size storage for button callbacks
+ * @details Contains the InlineAction class, which holds a callable object such
+ * as a lambda with captures inside the button that uses it, without any heap
+ * allocation.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_INLINEACTION_HPP
+#define LOUUI_INLINEACTION_HPP
+
+#include "../../include/display/lvgl.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace LouUI {
+    /**
+     * @class InlineAction
+     * @brief Callable object stored without heap allocation
+     * @details
+     * An InlineAction holds any copyable callable taking no parameters, such
+     * as a lambda with captures, in a fixed buffer inside the InlineAction
+     * itself. Callables larger than SIZE bytes are rejected at compile time.
+     * The callable may return an lv_res_t; a callable returning anything else
+     * is treated as returning LV_RES_OK.
+     */
+    class InlineAction {
+    public:
+
+        /**
+         * Number of bytes available for the callable and its captures
+         */
+        static constexpr std::size_t SIZE = 4 * sizeof(void *);
+
+    private:
+        using Invoke = lv_res_t (*)(void *);
+        using Copy = void (*)(void *, const void *);
+        using Destroy = void (*)(void *);
+
+        alignas(std::max_align_t) unsigned char storage[SIZE];
+        Invoke invoke = nullptr;
+        Copy copy = nullptr;
+        Destroy destroy = nullptr;
+
+        template <typename F>
+        static lv_res_t invokeFunc(void *f) {
+            using Result = decltype((*(F *)f)());
+            if constexpr(std::is_convertible<Result, lv_res_t>::value){
+                return (lv_res_t)(*(F *)f)();
+            }else{
+                (*(F *)f)();
+                return LV_RES_OK;
+            }
+        }
+
+        template <typename F>
+        static void copyFunc(void *dst, const void *src) {
+            new(dst) F(*(const F *)src);
+        }
+
+        template <typename F>
+        static void destroyFunc(void *f) {
+            ((F *)f)->~F();
+        }
+
+    public:
+
+        /**
+         * Creates an empty action
+         */
+        InlineAction() = default;
+
+        /**
+         * Creates an action holding a copy of a callable
+         * @param f The callable, which must fit in SIZE bytes
+         */
+        template <typename F, typename D = typename std::decay<F>::type,
+                  typename = typename std::enable_if<
+                          !std::is_same<D, InlineAction>::value>::type>
+        InlineAction(F &&f) {
+            static_assert(sizeof(D) <= SIZE,
+                          "Action captures too much to be stored inline");
+            static_assert(alignof(D) <= alignof(std::max_align_t),
+                          "Action is over-aligned");
+            new(storage) D(std::forward<F>(f));
+            invoke = invokeFunc<D>;
+            copy = copyFunc<D>;
+            destroy = destroyFunc<D>;
+        }
+
+        InlineAction(const InlineAction &a)
+                : invoke(a.invoke), copy(a.copy), destroy(a.destroy) {
+            if(copy) copy(storage, a.storage);
+        }
+
+        InlineAction &operator=(const InlineAction &a) {
+            if(this == &a) return *this;
+            reset();
+            if(a.copy) a.copy(storage, a.storage);
+            invoke = a.invoke;
+            copy = a.copy;
+            destroy = a.destroy;
+            return *this;
+        }
+
+        ~InlineAction() {
+            reset();
+        }
+
+        /**
+         * Destroys the stored callable, leaving the action empty
+         */
+        void reset() {
+            if(destroy) destroy(storage);
+            invoke = nullptr;
+            copy = nullptr;
+            destroy = nullptr;
+        }
+
+        /**
+         * Calls the stored callable
+         * @return The result of the callable, or LV_RES_OK
+         */
+        lv_res_t operator()() {
+            return invoke ? invoke(storage) : (lv_res_t)LV_RES_OK;
+        }
+
+        /**
+         * Checks whether a callable is stored
+         */
+        explicit operator bool() const {
+            return invoke != nullptr;
+        }
+    };
+}
+
+#endif //LOUUI_INLINEACTION_HPP
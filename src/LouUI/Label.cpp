@@ -28,7 +28,9 @@
  */
 
 #include "Label.hpp"
+#include "Memory.hpp"
 #include <string>
+#include <stdexcept>
 #include "Color.hpp"
 #include "../../include/display/lvgl.h"
 #include "../../include/display/lv_objx/lv_label.h"
@@ -37,7 +39,7 @@ LouUI::Label::Label(lv_obj_t *parent) : c("WHITE"){
     obj = lv_label_create(parent, nullptr);
     lv_label_set_recolor(obj, true);
 
-    style = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    style = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "Label", obj));
     lv_style_copy(style, &lv_style_pretty_color);
 
     lv_label_set_style(obj, style);
@@ -63,9 +65,7 @@ lv_style_t *LouUI::Label::getStyle() const {
 
 LouUI::Label *LouUI::Label::setColor(LouUI::Color c) {
     this->c = c;
-    std::string text = c.hexString() + " " + text;
-    lv_label_set_text(obj, text.c_str());
-    return this;
+    return setText(text);
 }
 
 LouUI::Label *LouUI::Label::setWidth(int width) {
@@ -103,6 +103,10 @@ yShift) {
 LouUI::Label *LouUI::Label::setText(std::string text) {
     this->text = text;
     text = c.hexString() + " " + text;
+
+    //lvgl re-measures and redraws the whole label on every set
+    if(text == shownText) return this;
+    shownText = text;
     lv_label_set_text(obj, text.c_str());
     return this;
 }
@@ -119,24 +123,20 @@ LouUI::Label *LouUI::Label::setTextAlign(TextAlign a) {
 
 LouUI::Label *LouUI::Label::setFont(int size, bool mono) {
     lv_font_t *f;
-//    if(mono){
-//        if(size == 10) f = &pros_font_dejavu_mono_10;
-//        else if(size == 20) f = &pros_font_dejavu_mono_20;
-//        else if(size == 30) f = &pros_font_dejavu_mono_30;
-//        else if(size == 40) f = &pros_font_dejavu_mono_40;
-//    }else{
-//        if(size == 10) f = &lv_font_dejavu_10;
-//        else if(size == 20) f = &lv_font_dejavu_20;
-//        else if(size == 30) f = &lv_font_dejavu_30;
-//        else if(size == 40) f = &lv_font_dejavu_40;
-//    }
-
-//    if(size == 10) f = &lv_font_dejavu_10;
-//    else if(size == 20) f = &lv_font_dejavu_20;
-//    else if(size == 30) f = &lv_font_dejavu_30;
-//    else if(size == 40) f = &lv_font_dejavu_40;
-
-    f = &dejavu_20;
+    if(mono){
+        if(size == 10) f = &pros_font_dejavu_mono_10;
+        else if(size == 20) f = &pros_font_dejavu_mono_20;
+        else if(size == 30) f = &pros_font_dejavu_mono_30;
+        else if(size == 40) f = &pros_font_dejavu_mono_40;
+        else throw std::invalid_argument("Invalid font size");
+    }else{
+        //20 uses the packed LouUI font, the rest come from the PROS kernel
+        if(size == 10) f = &lv_font_dejavu_10;
+        else if(size == 20) f = &dejavu_20;
+        else if(size == 30) f = &lv_font_dejavu_30;
+        else if(size == 40) f = &lv_font_dejavu_40;
+        else throw std::invalid_argument("Invalid font size");
+    }
 
     style->text.font = f;
     lv_obj_refresh_style(obj);
@@ -148,6 +148,3 @@ LouUI::Label *LouUI::Label::setOpacity(int opacity) {
     lv_obj_refresh_style(obj);
     return this;
 }
-
-
-
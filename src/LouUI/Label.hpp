@@ -51,6 +51,9 @@ namespace LouUI {
      * Therefore, you don't need to keep the string you in scope;
      * local variables are fine.
      *
+     * Setting the same text again does nothing, so labels can be refreshed
+     * from a loop without redrawing them every time.
+     *
      * @subsubsection newline Newlines
      * Newlines can be created using the newline character: <code>\\n</code>.
      * For example: <code>"line1\nline2\n\nline4"</code>
@@ -135,6 +138,9 @@ namespace LouUI {
         Color c;
         lv_style_t *style;
 
+        //text currently shown by lvgl (including the recolor command)
+        std::string shownText;
+
     public:
 
         /**
@@ -227,6 +233,7 @@ namespace LouUI {
          * Sets the font of the label
          * @param size font size. This can be: 10, 20, 30, or 40
          * @param mono whether or not the font is mono
+         * @throws std::invalid_argument if the size is not supported
          */
         Label* setFont(int size, bool mono = false);
 
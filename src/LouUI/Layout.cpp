@@ -0,0 +1,194 @@
+/**
+ * @file Layout.cpp
+ * @brief Declarative screen layouts
+ * @details Implementation file for LouUI layouts, which creates all the widgets
+ * of a layout table in a single pass
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Layout.hpp"
+#include <stdexcept>
+
+namespace {
+    void styleToggleButton(LouUI::ToggleButton *b,
+                           const LouUI::Layout::ButtonStyle &s) {
+        LouUI::Color released(s.released.r, s.released.g, s.released.b);
+        LouUI::Color pressed(s.pressed.r, s.pressed.g, s.pressed.b);
+        b->setMainColor(pressed, LouUI::ToggleButton::ALL_PRESSED)
+                ->setGradientColor(pressed, LouUI::ToggleButton::ALL_PRESSED)
+                ->setMainColor(released, LouUI::ToggleButton::ALL_RELEASED)
+                ->setGradientColor(released, LouUI::ToggleButton::ALL_RELEASED)
+                ->setBorderColor(LouUI::Color(s.border.r, s.border.g,
+                                              s.border.b),
+                                 LouUI::ToggleButton::ALL)
+                ->setBorderOpacity(s.borderOpacity, LouUI::ToggleButton::ALL)
+                ->setBorderWidth(s.toggledBorderWidth,
+                                 LouUI::ToggleButton::ALL_TOGGLED)
+                ->setBorderWidth(s.borderWidth,
+                                 LouUI::ToggleButton::ALL_UNTOGGLED);
+    }
+
+    void styleButton(LouUI::Button *b, const LouUI::Layout::ButtonStyle &s) {
+        LouUI::Color released(s.released.r, s.released.g, s.released.b);
+        LouUI::Color pressed(s.pressed.r, s.pressed.g, s.pressed.b);
+        b->setMainColor(pressed, LouUI::Button::PRESSED)
+                ->setGradientColor(pressed, LouUI::Button::PRESSED)
+                ->setMainColor(released, LouUI::Button::RELEASED)
+                ->setGradientColor(released, LouUI::Button::RELEASED)
+                ->setBorderColor(LouUI::Color(s.border.r, s.border.g,
+                                              s.border.b), LouUI::Button::ALL)
+                ->setBorderOpacity(s.borderOpacity, LouUI::Button::ALL)
+                ->setBorderWidth(s.borderWidth, LouUI::Button::ALL);
+    }
+}
+
+void LouUI::Layout::Screen::build(lv_obj_t *parent, const Widget *widgets,
+                                  std::size_t count, const ButtonStyle *styles,
+                                  std::size_t styleCount) {
+    entries.resize(count);
+
+    //first widget created with each style, later ones are copied from it
+    std::vector<int> buttonPrototypes(styleCount, -1);
+    std::vector<int> togglePrototypes(styleCount, -1);
+
+    for(std::size_t i = 0; i < count; i++){
+        const Widget &w = widgets[i];
+        Entry &e = entries[i];
+
+        if(w.parent != SCREEN && (w.parent < 0 || (std::size_t)w.parent >= i)){
+            throw std::invalid_argument("Layout parent must be an earlier widget");
+        }
+        if(w.style != NONE && (w.style < 0 || (std::size_t)w.style >= styleCount)){
+            throw std::invalid_argument("Invalid layout style");
+        }
+        lv_obj_t *p = w.parent == SCREEN ? parent : entries[w.parent].obj;
+
+        switch(w.type){
+            case BUTTON: {
+                int proto = w.style == NONE ? -1 : buttonPrototypes[w.style];
+                if(proto >= 0){
+                    e.button = new Button(p, *entries[proto].button);
+                }else{
+                    e.button = new Button(p);
+                    if(w.style != NONE){
+                        styleButton(e.button, styles[w.style]);
+                        buttonPrototypes[w.style] = i;
+                    }
+                }
+                if(w.action && w.fastAction){
+                    e.button->setFastAction(w.action);
+                }else if(w.action){
+                    e.button->setAction(w.action);
+                }
+                e.obj = e.button->getObj();
+                break;
+            }
+            case TOGGLE_BUTTON: {
+                int proto = w.style == NONE ? -1 : togglePrototypes[w.style];
+                if(proto >= 0){
+                    e.toggleButton = new ToggleButton(p,
+                                                      *entries[proto].toggleButton);
+                }else{
+                    e.toggleButton = new ToggleButton(p);
+                    if(w.style != NONE){
+                        styleToggleButton(e.toggleButton, styles[w.style]);
+                        togglePrototypes[w.style] = i;
+                    }
+                }
+                if(w.action && w.fastAction){
+                    e.toggleButton->setFastAction(w.action);
+                }else if(w.action){
+                    e.toggleButton->setAction(w.action);
+                }
+                e.obj = e.toggleButton->getObj();
+                break;
+            }
+            case LABEL:
+                e.label = new Label(p);
+                if(w.longMode >= 0){
+                    e.label->setLongMode((Label::LongMode)w.longMode);
+                }
+                if(w.textAlign >= 0){
+                    e.label->setTextAlign((Label::TextAlign)w.textAlign);
+                }
+                if(w.width >= 0) e.label->setWidth(w.width);
+                if(w.text) e.label->setText(w.text);
+                e.obj = e.label->getObj();
+                break;
+            case CHART:
+                e.chart = new Chart(p);
+                if(w.pointCount >= 0) e.chart->setPointCount(w.pointCount);
+                e.obj = e.chart->getObj();
+                break;
+        }
+
+        if(w.type != LABEL && w.width >= 0 && w.height >= 0){
+            lv_obj_set_size(e.obj, w.width, w.height);
+        }
+
+        //button captions are centered by the button's layout
+        if((w.type == BUTTON || w.type == TOGGLE_BUTTON) && w.text){
+            e.label = (new Label(e.obj))->setText(w.text);
+        }
+
+        if(w.aligned){
+            lv_obj_t *ref = w.ref == SCREEN ? p : entries[w.ref].obj;
+            lv_obj_align(e.obj, ref, (lv_align_t)w.alignType, w.xShift,
+                         w.yShift);
+        }else{
+            lv_obj_set_pos(e.obj, w.x, w.y);
+        }
+    }
+}
+
+lv_obj_t *LouUI::Layout::Screen::getObj(int i) const {
+    if(i < 0 || (std::size_t)i >= entries.size()){
+        throw std::invalid_argument("Invalid layout index");
+    }
+    return entries[i].obj;
+}
+
+LouUI::Button *LouUI::Layout::Screen::getButton(int i) const {
+    getObj(i);
+    if(entries[i].button) return entries[i].button;
+    throw std::invalid_argument("Layout widget is not a button");
+}
+
+LouUI::ToggleButton *LouUI::Layout::Screen::getToggleButton(int i) const {
+    getObj(i);
+    if(entries[i].toggleButton) return entries[i].toggleButton;
+    throw std::invalid_argument("Layout widget is not a toggle button");
+}
+
+LouUI::Label *LouUI::Layout::Screen::getLabel(int i) const {
+    getObj(i);
+    if(entries[i].label) return entries[i].label;
+    throw std::invalid_argument("Layout widget has no label");
+}
+
+LouUI::Chart *LouUI::Layout::Screen::getChart(int i) const {
+    getObj(i);
+    if(entries[i].chart) return entries[i].chart;
+    throw std::invalid_argument("Layout widget is not a chart");
+}
@@ -0,0 +1,392 @@
+/**
+ * @file Layout.hpp
+ * @brief Declarative screen layouts
+ * @details Header file for LouUI layouts. A layout is a constexpr table of
+ * widgets and shared styles. Positions that are aligned to earlier siblings are
+ * resolved by the compiler, and the whole screen is created at runtime in a
+ * single pass.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_LAYOUT_HPP
+#define LOUUI_LAYOUT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../include/display/lvgl.h"
+#include "Align.hpp"
+#include "Button.hpp"
+#include "ToggleButton.hpp"
+#include "Label.hpp"
+#include "Chart.hpp"
+
+namespace LouUI {
+    /**
+     * @namespace Layout
+     * @brief Declarative screen descriptions
+     * @details
+     * Instead of a chain of fluent calls, a screen can be described as a
+     * constexpr table of widgets. Widgets refer to their parent, alignment
+     * reference and style by index into the tables.
+     * @subsection usage Usage
+     * @code
+     * enum Widgets{LEFT, RIGHT};
+     * constexpr LouUI::Layout::ButtonStyle styles[] = {
+     *     {{125, 125, 125}, {140, 140, 140}, {255, 255, 255}, 255, 5, 0},
+     * };
+     * constexpr auto widgets = LouUI::Layout::resolve({
+     *     LouUI::Layout::toggleButton().at(27, 0).size(120, 40)
+     *             .withStyle(0).withText("LEFT"),
+     *     LouUI::Layout::toggleButton().size(120, 40)
+     *             .align(LEFT, LouUI::OUT_RIGHT_MID, 20, 0)
+     *             .withStyle(0).withText("RIGHT"),
+     * });
+     * LouUI::Layout::Screen screen(display.getScreen("Auton Selector"),
+     *                              widgets, styles);
+     * @endcode
+     * resolve() turns every alignment to an earlier sibling into an
+     * absolute position at compile time, so building the screen only sets
+     * each widget's size and position once. Widgets that share a style are
+     * copied from the first widget with that style, so the style setters
+     * run once per style instead of once per widget.
+     */
+    namespace Layout {
+
+        /**
+         * Index used as parent or alignment reference for the screen itself
+         */
+        constexpr int SCREEN = -1;
+
+        /**
+         * Index used when a widget has no style
+         */
+        constexpr int NONE = -1;
+
+        /**
+         * @struct Rgb
+         * @brief constexpr color, converted to a LouUI::Color when built
+         */
+        struct Rgb {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+
+        /**
+         * @struct ButtonStyle
+         * @brief Style shared by every button that references it
+         */
+        struct ButtonStyle {
+            /**Main and gradient color while released*/
+            Rgb released;
+            /**Main and gradient color while pressed*/
+            Rgb pressed;
+            Rgb border;
+            int borderOpacity;
+            /**Border width while toggled (toggle buttons only)*/
+            int toggledBorderWidth;
+            /**Border width while not toggled*/
+            int borderWidth;
+        };
+
+        /**
+         * @enum Type
+         * @brief Widget types that can be placed in a layout
+         */
+        enum Type{
+            BUTTON,
+            TOGGLE_BUTTON,
+            LABEL,
+            CHART
+        };
+
+        /**
+         * @struct Widget
+         * @brief One entry of a layout table
+         * @details Built with the modifier methods, which return modified
+         * copies so they can be chained in a constexpr initializer.
+         */
+        struct Widget {
+            Type type;
+            int parent = SCREEN;
+            int style = NONE;
+            int x = 0;
+            int y = 0;
+            int width = -1;
+            int height = -1;
+
+            bool aligned = false;
+            int ref = SCREEN;
+            Align alignType = CENTER;
+            int xShift = 0;
+            int yShift = 0;
+
+            const char *text = nullptr;
+            Button::Action action = nullptr;
+            bool fastAction = false;
+            int longMode = -1;
+            int textAlign = -1;
+            int pointCount = -1;
+
+            /**
+             * Places the widget inside another widget of the table
+             */
+            constexpr Widget in(int p) const {
+                Widget w = *this; w.parent = p; return w;
+            }
+
+            /**
+             * Sets the position of the widget in its parent
+             */
+            constexpr Widget at(int x, int y) const {
+                Widget w = *this; w.x = x; w.y = y; w.aligned = false;
+                return w;
+            }
+
+            /**
+             * Sets the size of the widget. Labels only use the width.
+             */
+            constexpr Widget size(int width, int height) const {
+                Widget w = *this; w.width = width; w.height = height;
+                return w;
+            }
+
+            /**
+             * Aligns the widget to an earlier sibling, or to the parent
+             * with SCREEN
+             */
+            constexpr Widget align(int ref, Align alignType, int xShift = 0,
+                                   int yShift = 0) const {
+                Widget w = *this;
+                w.aligned = true;
+                w.ref = ref;
+                w.alignType = alignType;
+                w.xShift = xShift;
+                w.yShift = yShift;
+                return w;
+            }
+
+            /**
+             * Sets the index of the widget's style
+             */
+            constexpr Widget withStyle(int s) const {
+                Widget w = *this; w.style = s; return w;
+            }
+
+            /**
+             * Sets the label text, or the caption of a button
+             */
+            constexpr Widget withText(const char *t) const {
+                Widget w = *this; w.text = t; return w;
+            }
+
+            /**
+             * Sets the action of a button
+             */
+            constexpr Widget withAction(Button::Action a) const {
+                Widget w = *this; w.action = a; w.fastAction = false; return w;
+            }
+
+            /**
+             * Sets the action of a button, run through TouchInput as soon as
+             * the button is released
+             */
+            constexpr Widget withFastAction(Button::Action a) const {
+                Widget w = *this; w.action = a; w.fastAction = true; return w;
+            }
+
+            /**
+             * Sets the long mode of a label
+             */
+            constexpr Widget withLongMode(Label::LongMode m) const {
+                Widget w = *this; w.longMode = m; return w;
+            }
+
+            /**
+             * Sets the text alignment of a label
+             */
+            constexpr Widget withTextAlign(Label::TextAlign a) const {
+                Widget w = *this; w.textAlign = a; return w;
+            }
+
+            /**
+             * Sets the point count of a chart
+             */
+            constexpr Widget withPointCount(int points) const {
+                Widget w = *this; w.pointCount = points; return w;
+            }
+        };
+
+        constexpr Widget button() { return Widget{BUTTON}; }
+
+        constexpr Widget toggleButton() { return Widget{TOGGLE_BUTTON}; }
+
+        constexpr Widget label() { return Widget{LABEL}; }
+
+        constexpr Widget chart() { return Widget{CHART}; }
+
+        /**
+         * Position of an object of size (w, h) aligned to a reference of
+         * size (refW, refH), relative to the reference. Matches
+         * lv_obj_align.
+         */
+        constexpr std::array<int, 2> alignOffset(Align a, int refW, int refH,
+                                                 int w, int h) {
+            switch(a){
+                case CENTER: return {refW / 2 - w / 2, refH / 2 - h / 2};
+                case IN_TOP_LEFT: return {0, 0};
+                case IN_TOP_MID: return {refW / 2 - w / 2, 0};
+                case IN_TOP_RIGHT: return {refW - w, 0};
+                case IN_BOTTOM_LEFT: return {0, refH - h};
+                case IN_BOTTOM_MID: return {refW / 2 - w / 2, refH - h};
+                case IN_BOTTOM_RIGHT: return {refW - w, refH - h};
+                case IN_LEFT_MID: return {0, refH / 2 - h / 2};
+                case IN_RIGHT_MID: return {refW - w, refH / 2 - h / 2};
+                case OUT_TOP_LEFT: return {0, -h};
+                case OUT_TOP_MID: return {refW / 2 - w / 2, -h};
+                case OUT_TOP_RIGHT: return {refW - w, -h};
+                case OUT_BOTTOM_LEFT: return {0, refH};
+                case OUT_BOTTOM_MID: return {refW / 2 - w / 2, refH};
+                case OUT_BOTTOM_RIGHT: return {refW - w, refH};
+                case OUT_LEFT_TOP: return {-w, 0};
+                case OUT_LEFT_MID: return {-w, refH / 2 - h / 2};
+                case OUT_LEFT_BOTTOM: return {-w, refH - h};
+                case OUT_RIGHT_TOP: return {refW, 0};
+                case OUT_RIGHT_MID: return {refW, refH / 2 - h / 2};
+                case OUT_RIGHT_BOTTOM: return {refW, refH - h};
+            }
+            return {0, 0};
+        }
+
+        /**
+         * Resolves every alignment to an earlier sibling into an absolute
+         * position. Used in a constexpr initializer, an invalid reference is
+         * a compile error.
+         */
+        template<std::size_t N>
+        constexpr std::array<Widget, N> resolve(const Widget (&table)[N]) {
+            std::array<Widget, N> out{};
+            for(std::size_t i = 0; i < N; i++){
+                Widget w = table[i];
+                if(w.aligned && w.ref != SCREEN){
+                    if(w.ref < 0 || (std::size_t)w.ref >= i){
+                        throw "Layout: align reference must be an earlier widget";
+                    }
+                    const Widget &r = out[w.ref];
+                    if(r.parent != w.parent){
+                        throw "Layout: align reference must be a sibling";
+                    }
+                    if(r.aligned){
+                        throw "Layout: align reference must not be aligned to the screen";
+                    }
+                    if(r.width < 0 || r.height < 0 || w.width < 0 ||
+                       w.height < 0){
+                        throw "Layout: aligned widgets need a fixed size";
+                    }
+                    std::array<int, 2> o = alignOffset(w.alignType, r.width,
+                                                       r.height, w.width,
+                                                       w.height);
+                    w.x = r.x + o[0] + w.xShift;
+                    w.y = r.y + o[1] + w.yShift;
+                    w.aligned = false;
+                }
+                out[i] = w;
+            }
+            return out;
+        }
+
+        /**
+         * @class Screen
+         * @brief The widgets created from a layout table
+         */
+        class Screen {
+        private:
+            struct Entry {
+                lv_obj_t *obj = nullptr;
+                Button *button = nullptr;
+                ToggleButton *toggleButton = nullptr;
+                Label *label = nullptr;
+                Chart *chart = nullptr;
+            };
+
+            std::vector<Entry> entries;
+
+            void build(lv_obj_t *parent, const Widget *widgets, std::size_t
+                       count, const ButtonStyle *styles, std::size_t
+                       styleCount);
+
+        public:
+            /**
+             * Creates every widget of a layout in one pass
+             * @param parent The object the screen is created in
+             * @param widgets resolved widget table
+             * @param styles style table the widgets refer to
+             */
+            template<std::size_t N, std::size_t S>
+            Screen(lv_obj_t *parent, const std::array<Widget, N> &widgets,
+                   const ButtonStyle (&styles)[S]) {
+                build(parent, widgets.data(), N, styles, S);
+            }
+
+            /**
+             * Creates every widget of a layout without styles in one pass
+             */
+            template<std::size_t N>
+            Screen(lv_obj_t *parent, const std::array<Widget, N> &widgets) {
+                build(parent, widgets.data(), N, nullptr, 0);
+            }
+
+            /**
+             * Gets the lvgl object of a widget
+             */
+            lv_obj_t *getObj(int i) const;
+
+            /**
+             * Gets a BUTTON widget
+             */
+            Button *getButton(int i) const;
+
+            /**
+             * Gets a TOGGLE_BUTTON widget
+             */
+            ToggleButton *getToggleButton(int i) const;
+
+            /**
+             * Gets a LABEL widget, or the caption label of a button
+             */
+            Label *getLabel(int i) const;
+
+            /**
+             * Gets a CHART widget
+             */
+            Chart *getChart(int i) const;
+        };
+    }
+}
+
+
+#endif //LOUUI_LAYOUT_HPP
@@ -0,0 +1,225 @@
+/**
+ * @file Memory.cpp
+ * @brief Implementation of Memory
+ * @details Implements the Memory class and, with LOUUI_BENCHMARK, the counting
+ * operator new
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Memory.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+    //keeps the memory after the header aligned like malloc's
+    constexpr std::size_t HEADER_SIZE =
+            (8 + alignof(std::max_align_t) - 1) &
+            ~(alignof(std::max_align_t) - 1);
+}
+
+#ifdef LOUUI_BENCHMARK
+namespace {
+    std::atomic<uint32_t> newCount{0};
+}
+
+void *operator new(std::size_t size) {
+    newCount.fetch_add(1, std::memory_order_relaxed);
+    if(void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+uint32_t LouUI::Memory::getNewCount() {
+    return newCount.load(std::memory_order_relaxed);
+}
+#else
+uint32_t LouUI::Memory::getNewCount() {
+    return 0;
+}
+#endif
+
+std::vector<LouUI::Memory::Entry> LouUI::Memory::entries;
+std::vector<LouUI::Memory::Screen> LouUI::Memory::screens;
+LouUI::Memory::Stats LouUI::Memory::total = {};
+//created before any task can allocate, so two tasks can't both create it
+pros::Mutex *LouUI::Memory::mutex = new pros::Mutex();
+
+void LouUI::Memory::lock() {
+    mutex->take(TIMEOUT_MAX);
+}
+
+void LouUI::Memory::unlock() {
+    mutex->give();
+}
+
+std::string LouUI::Memory::screenName(lv_obj_t *obj) {
+    for(lv_obj_t *o = obj; o; o = lv_obj_get_parent(o)){
+        for(const Screen &s : screens){
+            if(s.obj == o) return s.name;
+        }
+    }
+    return "other";
+}
+
+void LouUI::Memory::record(LouUI::Memory::Stats &s, int32_t bytes) {
+    if(bytes >= 0){
+        s.allocations++;
+        s.bytes += bytes;
+        s.peak = std::max(s.peak, s.bytes);
+    }else{
+        s.frees++;
+        s.bytes -= -bytes;
+    }
+}
+
+void *LouUI::Memory::alloc(std::size_t size, const char *type,
+                           lv_obj_t *obj) {
+    auto *block = (uint8_t *)(std::malloc(HEADER_SIZE + size));
+    if(!block) return nullptr;
+
+    std::string screen = screenName(obj);
+    lock();
+    size_t i = 0;
+    while(i < entries.size() &&
+          (entries[i].type != type || entries[i].screen != screen)) i++;
+    if(i == entries.size()) entries.push_back({type, screen, {}});
+    record(entries[i].stats, size);
+    record(total, size);
+    unlock();
+
+    Header h = {(uint32_t)size, (uint32_t)i};
+    std::memcpy(block, &h, sizeof(h));
+    return block + HEADER_SIZE;
+}
+
+void LouUI::Memory::free(void *p) {
+    if(!p) return;
+    uint8_t *block = (uint8_t *)p - HEADER_SIZE;
+    Header h;
+    std::memcpy(&h, block, sizeof(h));
+
+    lock();
+    record(entries[h.entry].stats, -(int32_t)h.size);
+    record(total, -(int32_t)h.size);
+    unlock();
+    std::free(block);
+}
+
+void LouUI::Memory::addScreen(lv_obj_t *screen, std::string name) {
+    lock();
+    screens.push_back({screen, name});
+    unlock();
+}
+
+LouUI::Memory::Stats LouUI::Memory::getTotal() {
+    lock();
+    Stats s = total;
+    unlock();
+    return s;
+}
+
+std::vector<LouUI::Memory::Entry> LouUI::Memory::getEntries() {
+    lock();
+    std::vector<Entry> copy = entries;
+    unlock();
+    return copy;
+}
+
+void LouUI::Memory::countObjects(lv_obj_t *obj, const std::string &screen,
+                                 std::vector<ObjectCount> &counts) {
+    std::string name = screen;
+    for(const Screen &s : screens){
+        if(s.obj == obj) name = s.name;
+    }
+
+    lv_obj_type_t type;
+    lv_obj_get_type(obj, &type);
+    std::string typeName = type.type[0] ? type.type[0] : "?";
+    auto it = std::find_if(counts.begin(), counts.end(),
+                           [&](const ObjectCount &c){
+                               return c.type == typeName && c.screen == name;
+                           });
+    if(it == counts.end()) counts.push_back({typeName, name, 1});
+    else it->count++;
+
+    for(lv_obj_t *child = lv_obj_get_child(obj, nullptr); child;
+        child = lv_obj_get_child(obj, child)){
+        countObjects(child, name, counts);
+    }
+}
+
+std::vector<LouUI::Memory::ObjectCount> LouUI::Memory::getObjectCounts() {
+    std::vector<ObjectCount> counts;
+    lock();
+    countObjects(lv_scr_act(), "other", counts);
+    unlock();
+    return counts;
+}
+
+void LouUI::Memory::dump() {
+    Stats t = getTotal();
+    std::printf("LouUI memory: %lu bytes in %lu allocations, peak %lu "
+                "bytes\n", (unsigned long)t.bytes,
+                (unsigned long)(t.allocations - t.frees),
+                (unsigned long)t.peak);
+    for(const Entry &e : getEntries()){
+        std::printf("LouUI memory %s/%s: %lu bytes, %lu allocations, "
+                    "%lu frees, peak %lu bytes\n", e.screen.c_str(),
+                    e.type.c_str(), (unsigned long)e.stats.bytes,
+                    (unsigned long)e.stats.allocations,
+                    (unsigned long)e.stats.frees,
+                    (unsigned long)e.stats.peak);
+    }
+    for(const ObjectCount &c : getObjectCounts()){
+        std::printf("LouUI objects %s/%s: %lu\n", c.screen.c_str(),
+                    c.type.c_str(), (unsigned long)c.count);
+    }
+#ifdef LOUUI_BENCHMARK
+    std::printf("LouUI operator new calls: %lu\n",
+                (unsigned long)getNewCount());
+#endif
+}
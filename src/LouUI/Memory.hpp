@@ -0,0 +1,174 @@
+/**
+ * @file Memory.hpp
+ * @brief Allocation tracking for LouUI
+ * @details Contains the Memory class, which counts the memory used by LouUI
+ * elements by type and screen, along with the lvgl objects on each screen.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_MEMORY_HPP
+#define LOUUI_MEMORY_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+
+namespace LouUI {
+    /**
+     * @class Memory
+     * @brief Counts the memory used by the UI
+     * @details
+     * LouUI elements allocate their styles and buffers through alloc(), which
+     * tags each allocation with the type of the element and the screen it
+     * is on. The screen is the closest ancestor added to the Display, so
+     * screens are named after their tabs.
+     *
+     * lvgl allocates its objects from the kernel heap through kmalloc, which
+     * cannot be hooked, so for lvgl the number of objects of each type on
+     * each screen is counted instead, by walking the object tree when
+     * requested. A growing count points to the same leaks a growing heap
+     * would.
+     *
+     * When the project is built with LOUUI_BENCHMARK set to 1 in the
+     * Makefile, every operator new is counted as well.
+     * @subsection usage Usage
+     * @code
+     * //e.g. from a button during a practice session
+     * LouUI::Memory::dump();
+     * @endcode
+     */
+    class Memory {
+    public:
+
+        /**
+         * @struct Stats
+         * @brief Counts for one group of allocations
+         */
+        struct Stats {
+            /**Number of allocations*/
+            uint32_t allocations;
+            /**Number of frees*/
+            uint32_t frees;
+            /**Bytes currently allocated*/
+            uint32_t bytes;
+            /**Most bytes allocated at once*/
+            uint32_t peak;
+        };
+
+        /**
+         * @struct Entry
+         * @brief Counts for one type of element on one screen
+         */
+        struct Entry {
+            std::string type;
+            std::string screen;
+            Stats stats;
+        };
+
+        /**
+         * @struct ObjectCount
+         * @brief Number of lvgl objects of one type on one screen
+         */
+        struct ObjectCount {
+            std::string type;
+            std::string screen;
+            uint32_t count;
+        };
+
+    private:
+        struct Screen {
+            lv_obj_t *obj;
+            std::string name;
+        };
+
+        struct Header {
+            uint32_t size;
+            uint32_t entry;
+        };
+
+        static std::vector<Entry> entries;
+        static std::vector<Screen> screens;
+        static Stats total;
+        static pros::Mutex *mutex;
+
+        static void lock();
+        static void unlock();
+        static std::string screenName(lv_obj_t *obj);
+        static void countObjects(lv_obj_t *obj, const std::string &screen,
+                                 std::vector<ObjectCount> &counts);
+        static void record(Stats &s, int32_t bytes);
+
+    public:
+
+        /**
+         * Allocates memory for an element
+         * @param size number of bytes
+         * @param type type of the element, e.g. "Button"
+         * @param obj the element's object, used to find its screen
+         */
+        static void *alloc(std::size_t size, const char *type, lv_obj_t *obj);
+
+        /**
+         * Frees memory allocated with alloc()
+         */
+        static void free(void *p);
+
+        /**
+         * Names a screen. Called by Display::addScreen(std::string name).
+         */
+        static void addScreen(lv_obj_t *screen, std::string name);
+
+        /**
+         * Gets the totals of every allocation made with alloc()
+         */
+        static Stats getTotal();
+
+        /**
+         * Gets the counts for each element type on each screen
+         */
+        static std::vector<Entry> getEntries();
+
+        /**
+         * Gets the number of lvgl objects of each type on each screen
+         */
+        static std::vector<ObjectCount> getObjectCounts();
+
+        /**
+         * Gets the number of operator new calls, or 0 if the project was not
+         * built with LOUUI_BENCHMARK
+         */
+        static uint32_t getNewCount();
+
+        /**
+         * Prints every count to the terminal
+         */
+        static void dump();
+    };
+}
+
+
+#endif //LOUUI_MEMORY_HPP
@@ -0,0 +1,277 @@
+/**
+ * @file PIDTuner.cpp
+ * @brief Implementation of PIDTuner
+ * @details Implements the PIDTuner class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "PIDTuner.hpp"
+#include "Memory.hpp"
+#include "../../include/display/lv_objx/lv_spinbox.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+    constexpr int CONTROLS_WIDTH = 244;
+    constexpr int32_t MAX_STEP = 10000;
+    constexpr int32_t MAX_MANTISSA = 99999;
+
+    //the value of the last digit of a gain with this leading exponent
+    double unit(int exponent) {
+        return std::pow(10.0, exponent - (LouUI::PIDTuner::DIGITS - 1));
+    }
+}
+
+LouUI::PIDTuner::PIDTuner(lv_obj_t *parent,
+                          std::shared_ptr<okapi::IterativePosPIDController>
+                          controller)
+        : controller(controller), iterative(controller.get()) {
+    okapi::IterativePosPIDController::Gains gains = controller->getGains();
+    setGains = [controller](const Gains &g){
+        okapi::IterativePosPIDController::Gains current =
+                controller->getGains();
+        current.kP = g.kP;
+        current.kI = g.kI;
+        current.kD = g.kD;
+        controller->setGains(current);
+    };
+    build(parent, {gains.kP, gains.kI, gains.kD});
+}
+
+LouUI::PIDTuner::PIDTuner(lv_obj_t *parent,
+                          std::shared_ptr<okapi::ClosedLoopController<double,
+                                  double>> controller,
+                          const Gains &gains, GainsSetter setGains)
+        : controller(controller),
+          iterative(dynamic_cast<okapi::IterativeController<double, double> *>(
+                  controller.get())),
+          setGains(std::move(setGains)) {
+    build(parent, gains);
+}
+
+void LouUI::PIDTuner::build(lv_obj_t *parent, const Gains &gains) {
+    obj = lv_obj_create(parent, nullptr);
+    style = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t), "PIDTuner", obj));
+    lv_style_copy(style, &lv_style_transp);
+    lv_obj_set_style(obj, style);
+
+    chart = (new Chart(obj))
+            ->setPointCount(100)
+            ->setRange(min, max)
+            ->addSeries("target", Color("BLUE"))
+            ->addSeries("error", Color("RED"))
+            ->addSeries("output", Color("GREEN"));
+
+    controls = (new Container(obj))
+            ->setType(Container::GRID)
+            ->setColumns(5)
+            ->setGap(4)
+            ->setCrossAlign(Container::CENTER)
+            ->setFit(true);
+
+    initialGains = gains;
+    for(std::atomic<int32_t> &g : pendingGains) g.store(0);
+    for(std::atomic<int32_t> &e : pendingExponents) e.store(0);
+    addGain(0, "P", gains.kP);
+    addGain(1, "I", gains.kI);
+    addGain(2, "D", gains.kD);
+
+    setSize(lv_obj_get_width(parent), lv_obj_get_height(parent));
+
+    drain = lv_task_create(drainTask, 40, LV_TASK_PRIO_MID, this);
+}
+
+void LouUI::PIDTuner::addGain(int index, const char *name, double value) {
+    lv_obj_t *parent = controls->getObj();
+
+    Button *nameButton = (new Button(parent))->setSize(40, 40);
+    (new Label(nameButton->getObj()))->setText(name);
+    Button *minus = (new Button(parent))->setSize(30, 40);
+    (new Label(minus->getObj()))->setText("-");
+
+    //the leading digit sits at the gain's own power of ten
+    int exponent = 0;
+    if(value > 0) exponent = (int)std::floor(std::log10(value));
+    exponent = std::max(MIN_EXPONENT, std::min(exponent, MAX_EXPONENT));
+    int32_t mantissa = (int32_t)std::lround(value / unit(exponent));
+    mantissa = std::max<int32_t>(0, std::min(mantissa, MAX_MANTISSA));
+
+    lv_obj_t *spinbox = lv_spinbox_create(parent, nullptr);
+    lv_spinbox_set_digit_format(spinbox, DIGITS, 1);
+    lv_spinbox_set_range(spinbox, 0, MAX_MANTISSA);
+    lv_spinbox_set_step(spinbox, 1);
+    lv_spinbox_set_value(spinbox, mantissa);
+    lv_obj_set_size(spinbox, 80, 40);
+
+    Button *plus = (new Button(parent))->setSize(30, 40);
+    (new Label(plus->getObj()))->setText("+");
+    Button *exponentButton = (new Button(parent))->setSize(40, 40);
+    Label *exponentLabel = new Label(exponentButton->getObj());
+    boxes[index] = {spinbox, exponentLabel, 1, exponent};
+    showExponent(index);
+
+    //tapping the name moves to the next digit, wrapping to the last one
+    nameButton->setAction([this, index]{
+        GainBox &b = boxes[index];
+        b.step = b.step >= MAX_STEP ? 1 : b.step * 10;
+        lv_spinbox_set_step(b.spinbox, b.step);
+        lv_spinbox_set_value(b.spinbox, lv_spinbox_get_value(b.spinbox));
+    });
+    minus->setAction([this, index]{
+        lv_spinbox_decrement(boxes[index].spinbox);
+        stageGains(index);
+    });
+    plus->setAction([this, index]{
+        lv_spinbox_increment(boxes[index].spinbox);
+        stageGains(index);
+    });
+    //the power of ten goes up by one, wrapping to the smallest
+    exponentButton->setAction([this, index]{
+        GainBox &b = boxes[index];
+        b.exponent = b.exponent >= MAX_EXPONENT ? MIN_EXPONENT :
+                     b.exponent + 1;
+        showExponent(index);
+        stageGains(index);
+    });
+
+    controls->addChild(nameButton->getObj())
+            ->addChild(minus->getObj())
+            ->addChild(spinbox)
+            ->addChild(plus->getObj())
+            ->addChild(exponentButton->getObj());
+}
+
+void LouUI::PIDTuner::showExponent(int index) {
+    char text[8];
+    std::snprintf(text, sizeof(text), "e%d", boxes[index].exponent);
+    boxes[index].exponentLabel->setText(text);
+}
+
+void LouUI::PIDTuner::stageGains(int index) {
+    touched |= 1u << index;
+    //seqlock: an odd version tells the control loop a write is in progress
+    uint32_t version = gainsVersion.load(std::memory_order_relaxed);
+    gainsVersion.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for(int i = 0; i < 3; i++){
+        pendingGains[i].store(lv_spinbox_get_value(boxes[i].spinbox),
+                              std::memory_order_relaxed);
+        pendingExponents[i].store(boxes[i].exponent,
+                                  std::memory_order_relaxed);
+    }
+    pendingTouched.store(touched, std::memory_order_relaxed);
+    gainsVersion.store(version + 2, std::memory_order_release);
+}
+
+void LouUI::PIDTuner::applyGains() {
+    uint32_t version = gainsVersion.load(std::memory_order_acquire);
+    if((version & 1) || version == appliedVersion) return;
+
+    int32_t g[3];
+    int32_t e[3];
+    for(int i = 0; i < 3; i++){
+        g[i] = pendingGains[i].load(std::memory_order_relaxed);
+        e[i] = pendingExponents[i].load(std::memory_order_relaxed);
+    }
+    uint32_t edited = pendingTouched.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    //the UI changed the gains while they were read, try next iteration
+    if(gainsVersion.load(std::memory_order_relaxed) != version) return;
+
+    //gains that were never edited keep their exact starting value
+    appliedVersion = version;
+    double initial[3] = {initialGains.kP, initialGains.kI, initialGains.kD};
+    double k[3];
+    for(int i = 0; i < 3; i++){
+        k[i] = edited & (1u << i) ? g[i] * unit(e[i]) : initial[i];
+    }
+    setGains({k[0], k[1], k[2]});
+}
+
+int16_t LouUI::PIDTuner::toChart(double value) const {
+    if(value > INT16_MAX) return INT16_MAX;
+    if(value < INT16_MIN) return INT16_MIN;
+    return (int16_t)std::lround(value);
+}
+
+void LouUI::PIDTuner::drainTask(void *param) {
+    auto *t = (PIDTuner *)param;
+    Sample s;
+    while(t->samples.pop(s)){
+        t->chart->addData("target", t->toChart(s.target))
+                ->addData("error", t->toChart(s.error))
+                ->addData("output", t->toChart(s.output * t->max));
+    }
+}
+
+lv_obj_t *LouUI::PIDTuner::getObj() const {
+    return obj;
+}
+
+LouUI::Chart *LouUI::PIDTuner::getChart() const {
+    return chart;
+}
+
+void LouUI::PIDTuner::sample() {
+    sample(iterative ? iterative->getOutput() : 0);
+}
+
+void LouUI::PIDTuner::sample(double output) {
+    applyGains();
+    samples.push({(float)controller->getTarget(),
+                  (float)controller->getError(), (float)output});
+}
+
+LouUI::PIDTuner *LouUI::PIDTuner::setRange(int min, int max) {
+    this->min = min;
+    this->max = max;
+    chart->setRange(min, max);
+    return this;
+}
+
+LouUI::PIDTuner *LouUI::PIDTuner::setPointCount(int points) {
+    chart->setPointCount(points);
+    return this;
+}
+
+LouUI::PIDTuner *LouUI::PIDTuner::setDecimation(int factor) {
+    chart->setDecimation(factor);
+    return this;
+}
+
+LouUI::PIDTuner *LouUI::PIDTuner::setSize(int width, int height) {
+    lv_obj_set_size(obj, width, height);
+    chart->setSize(width - CONTROLS_WIDTH, height);
+    controls->setPosition(width - CONTROLS_WIDTH + 8, 0);
+    return this;
+}
+
+LouUI::PIDTuner *
+LouUI::PIDTuner::align(lv_obj_t *ref, LouUI::Align alignType, int xShift,
+                       int yShift) {
+    lv_obj_align(obj, ref, (lv_align_t)alignType, xShift, yShift);
+    return this;
+}
@@ -0,0 +1,240 @@
+/**
+ * @file PIDTuner.hpp
+ * @brief Screen for tuning PID gains while the robot runs
+ * @details Contains the PIDTuner class, which plots the target, error and
+ * output of an okapi controller and adjusts its gains live.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_PIDTUNER_HPP
+#define LOUUI_PIDTUNER_HPP
+
+#include "../../include/display/lvgl.h"
+#include "../../include/okapi/api/control/closedLoopController.hpp"
+#include "../../include/okapi/api/control/iterative/iterativeController.hpp"
+#include "../../include/okapi/api/control/iterative/iterativePosPidController.hpp"
+#include "Align.hpp"
+#include "Button.hpp"
+#include "Chart.hpp"
+#include "Container.hpp"
+#include "Label.hpp"
+#include "SampleBuffer.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace LouUI {
+    /**
+     * @class PIDTuner
+     * @brief Plots a controller and adjusts its gains live
+     * @details
+     * A PIDTuner shows a chart of the target, error and output of an okapi
+     * controller, next to spinboxes for kP, kI and kD. Tapping a gain's name
+     * selects the digit changed by its - and + buttons. Each gain is edited
+     * as DIGITS significant digits times a power of ten, shown and cycled
+     * by the button after its +, so gains like 0.00002 keep their digits.
+     * Only the gains edited on the screen are written to the controller.
+     *
+     * The control loop calls sample() once per iteration. sample() never
+     * blocks: it pushes the values into a lock-free buffer that the UI drains
+     * before each screen refresh, and applies gains changed on the screen
+     * between two iterations of the loop, never during one.
+     * @subsection usage Usage
+     * @code
+     * auto pid = std::make_shared<okapi::IterativePosPIDController>(
+     *         0.001, 0, 0, 0, okapi::TimeUtilFactory::createDefault());
+     * auto *tuner = (new LouUI::PIDTuner(lv_scr_act(), pid))
+     *         ->setRange(-1000, 1000);
+     *
+     * //control loop
+     * while(true){
+     *     motor.controllerSet(pid->step(motor.getPosition()));
+     *     tuner->sample();
+     *     pros::delay(10);
+     * }
+     * @endcode
+     */
+    class PIDTuner {
+    public:
+
+        /**
+         * @struct Gains
+         * @brief Gains adjusted by the tuner
+         */
+        struct Gains {
+            double kP;
+            double kI;
+            double kD;
+        };
+
+        /**
+         * Called from the control loop to apply new gains
+         */
+        using GainsSetter = std::function<void(const Gains &)>;
+
+        /**
+         * Gains are edited with this many significant digits
+         */
+        static constexpr int DIGITS = 5;
+
+        /**
+         * Smallest power of ten of the leading digit of a gain
+         */
+        static constexpr int MIN_EXPONENT = -7;
+
+        /**
+         * Largest power of ten of the leading digit of a gain
+         */
+        static constexpr int MAX_EXPONENT = 3;
+
+    private:
+        struct Sample {
+            float target;
+            float error;
+            float output;
+        };
+
+        struct GainBox {
+            lv_obj_t *spinbox;
+            Label *exponentLabel;
+            int32_t step;
+            int exponent;
+        };
+
+        lv_obj_t *obj;
+        lv_style_t *style;
+        Chart *chart;
+        Container *controls;
+        GainBox boxes[3];
+
+        std::shared_ptr<okapi::ClosedLoopController<double, double>> controller;
+        okapi::IterativeController<double, double> *iterative;
+        GainsSetter setGains;
+
+        SampleBuffer<Sample, 256> samples;
+        int16_t min = -1000;
+        int16_t max = 1000;
+        lv_task_t *drain;
+
+        std::atomic<uint32_t> gainsVersion{0};
+        std::atomic<int32_t> pendingGains[3];
+        std::atomic<int32_t> pendingExponents[3];
+        std::atomic<uint32_t> pendingTouched{0};
+        uint32_t touched = 0;
+        uint32_t appliedVersion = 0;
+        Gains initialGains;
+
+        void build(lv_obj_t *parent, const Gains &gains);
+        void addGain(int index, const char *name, double value);
+        void stageGains(int index);
+        void showExponent(int index);
+        void applyGains();
+        int16_t toChart(double value) const;
+
+        static void drainTask(void *param);
+
+    public:
+
+        /**
+         * Creates a tuner for a position PID controller, whose gains are set
+         * directly
+         * @param parent The object the tuner is created in
+         * @param controller The controller to tune
+         */
+        PIDTuner(lv_obj_t *parent,
+                 std::shared_ptr<okapi::IterativePosPIDController> controller);
+
+        /**
+         * Creates a tuner for any closed loop controller
+         * @param parent The object the tuner is created in
+         * @param controller The controller to plot
+         * @param gains The gains shown initially
+         * @param setGains Applies new gains to the controller. Called from
+         * the control loop, inside sample().
+         */
+        PIDTuner(lv_obj_t *parent,
+                 std::shared_ptr<okapi::ClosedLoopController<double, double>>
+                 controller, const Gains &gains, GainsSetter setGains);
+
+        /**
+         * Getter for obj
+         */
+        lv_obj_t *getObj() const;
+
+        /**
+         * Getter for the chart, e.g. to restyle it
+         */
+        Chart *getChart() const;
+
+        /**
+         * Records the controller's target, error and output and applies any
+         * gains changed on the screen. Call once per iteration of the control
+         * loop, after stepping the controller. The output is read from
+         * controllers that are iterative; for other controllers use
+         * sample(double output).
+         */
+        void sample();
+
+        /**
+         * Records the controller's target and error, with the given output,
+         * and applies any gains changed on the screen
+         * @param output The output of the controller in [-1, 1]
+         */
+        void sample(double output);
+
+        /**
+         * Sets the range of the target and error on the chart. The output,
+         * which is in [-1, 1], is scaled to fill the same range.
+         */
+        PIDTuner *setRange(int min, int max);
+
+        /**
+         * Sets the number of points shown for each value
+         */
+        PIDTuner *setPointCount(int points);
+
+        /**
+         * Plots one point for every factor samples
+         * @see Chart::setDecimation(int factor)
+         */
+        PIDTuner *setDecimation(int factor);
+
+        /**
+         * Sets the size of the tuner
+         */
+        PIDTuner *setSize(int width, int height);
+
+        /**
+         * Aligns the tuner to another object
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift x offset after alignment
+         * @param yShift y offset after alignment
+         */
+        PIDTuner *align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                        int yShift = 0);
+    };
+}
+
+#endif //LOUUI_PIDTUNER_HPP
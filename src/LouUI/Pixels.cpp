@@ -0,0 +1,188 @@
+/**
+ * @file Pixels.cpp
+ * @brief Implementation of Pixels
+ * @details Implements the Pixels class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Pixels.hpp"
+
+#if LV_COLOR_DEPTH == 32 && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LOUUI_PIXELS_NEON
+#elif LV_COLOR_DEPTH == 32 && defined(__SSE2__)
+#include <emmintrin.h>
+#define LOUUI_PIXELS_SSE2
+#endif
+
+#if defined(__ARM_NEON) && !defined(LOUUI_PIXELS_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__) && !defined(LOUUI_PIXELS_SSE2)
+#include <emmintrin.h>
+#endif
+
+void LouUI::Pixels::fillScalar(lv_color_t *dest, uint32_t length,
+                               lv_color_t color) {
+    for(uint32_t i = 0; i < length; i++) dest[i] = color;
+}
+
+void LouUI::Pixels::blendScalar(lv_color_t *dest, const lv_color_t *src,
+                                uint32_t length, lv_opa_t opa) {
+    if(opa == LV_OPA_COVER){
+        for(uint32_t i = 0; i < length; i++) dest[i] = src[i];
+        return;
+    }
+    if(opa == LV_OPA_TRANSP) return;
+
+    for(uint32_t i = 0; i < length; i++){
+        dest[i] = lv_color_mix(src[i], dest[i], opa);
+    }
+}
+
+void LouUI::Pixels::fill(lv_color_t *dest, uint32_t length,
+                         lv_color_t color) {
+    uint32_t i = 0;
+#if defined(LOUUI_PIXELS_NEON)
+    uint32x4_t c = vdupq_n_u32(color.full);
+    uint32_t *d = (uint32_t *)dest;
+    for(; i + 8 <= length; i += 8){
+        vst1q_u32(d + i, c);
+        vst1q_u32(d + i + 4, c);
+    }
+#elif defined(LOUUI_PIXELS_SSE2)
+    __m128i c = _mm_set1_epi32((int)color.full);
+    for(; i + 4 <= length; i += 4){
+        _mm_storeu_si128((__m128i *)(dest + i), c);
+    }
+#endif
+    fillScalar(dest + i, length - i, color);
+}
+
+void LouUI::Pixels::blend(lv_color_t *dest, const lv_color_t *src,
+                          uint32_t length, lv_opa_t opa) {
+    //any other opacity is mixed, so every path matches lv_color_mix()
+    if(opa == LV_OPA_COVER || opa == LV_OPA_TRANSP){
+        blendScalar(dest, src, length, opa);
+        return;
+    }
+
+    uint32_t i = 0;
+#if defined(LOUUI_PIXELS_NEON)
+    //8 pixels at a time, split into blue, green, red and alpha lanes
+    uint8x8_t a = vdup_n_u8(opa);
+    uint8x8_t inv = vdup_n_u8(255 - opa);
+    for(; i + 8 <= length; i += 8){
+        uint8x8x4_t s = vld4_u8((const uint8_t *)(src + i));
+        uint8x8x4_t d = vld4_u8((const uint8_t *)(dest + i));
+        for(int c = 0; c < 3; c++){
+            uint16x8_t mixed = vmull_u8(s.val[c], a);
+            mixed = vmlal_u8(mixed, d.val[c], inv);
+            d.val[c] = vshrn_n_u16(mixed, 8);
+        }
+        d.val[3] = vdup_n_u8(0xFF);
+        vst4_u8((uint8_t *)(dest + i), d);
+    }
+#elif defined(LOUUI_PIXELS_SSE2)
+    //4 pixels at a time, widened to 16 bits per channel
+    __m128i zero = _mm_setzero_si128();
+    __m128i a = _mm_set1_epi16(opa);
+    __m128i inv = _mm_set1_epi16(255 - opa);
+    __m128i alpha = _mm_set1_epi32((int)0xFF000000);
+    for(; i + 4 <= length; i += 4){
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dest + i));
+        __m128i low = _mm_add_epi16(
+                _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), a),
+                _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), inv));
+        __m128i high = _mm_add_epi16(
+                _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), a),
+                _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), inv));
+        __m128i mixed = _mm_packus_epi16(_mm_srli_epi16(low, 8),
+                                         _mm_srli_epi16(high, 8));
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_or_si128(mixed, alpha));
+    }
+#endif
+    blendScalar(dest + i, src + i, length - i, opa);
+}
+
+void LouUI::Pixels::quantizeScalar(const float *values, uint8_t *out,
+                                   uint32_t length, float min, float scale) {
+    for(uint32_t i = 0; i < length; i++){
+        float x = (values[i] - min) * scale;
+        if(!(x > 0)) x = 0;
+        if(x > 255) x = 255;
+        out[i] = (uint8_t)(x + 0.5f);
+    }
+}
+
+void LouUI::Pixels::quantize(const float *values, uint8_t *out,
+                             uint32_t length, float min, float scale) {
+    uint32_t i = 0;
+#if defined(__ARM_NEON)
+    float32x4_t low = vdupq_n_f32(min);
+    float32x4_t factor = vdupq_n_f32(scale);
+    float32x4_t zero = vdupq_n_f32(0);
+    float32x4_t top = vdupq_n_f32(255);
+    float32x4_t half = vdupq_n_f32(0.5f);
+    for(; i + 8 <= length; i += 8){
+        uint16x4_t halves[2];
+        for(int h = 0; h < 2; h++){
+            float32x4_t x = vmulq_f32(vsubq_f32(vld1q_f32(values + i + 4 * h),
+                                                low), factor);
+            //a compare is false for NaN, which then becomes 0
+            x = vbslq_f32(vcgtq_f32(x, zero), x, zero);
+            x = vaddq_f32(vminq_f32(x, top), half);
+            halves[h] = vmovn_u32(vcvtq_u32_f32(x));
+        }
+        vst1_u8(out + i, vmovn_u16(vcombine_u16(halves[0], halves[1])));
+    }
+#elif defined(__SSE2__)
+    __m128 low = _mm_set1_ps(min);
+    __m128 factor = _mm_set1_ps(scale);
+    __m128 zero = _mm_setzero_ps();
+    __m128 top = _mm_set1_ps(255);
+    __m128 half = _mm_set1_ps(0.5f);
+    for(; i + 8 <= length; i += 8){
+        __m128i halves[2];
+        for(int h = 0; h < 2; h++){
+            __m128 x = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(values + i + 4 * h),
+                                             low), factor);
+            //maxps returns its second operand for NaN, which is 0
+            x = _mm_max_ps(x, zero);
+            x = _mm_add_ps(_mm_min_ps(x, top), half);
+            halves[h] = _mm_cvttps_epi32(x);
+        }
+        __m128i packed = _mm_packus_epi16(
+                _mm_packs_epi32(halves[0], halves[1]), _mm_setzero_si128());
+        _mm_storel_epi64((__m128i *)(out + i), packed);
+    }
+#endif
+    quantizeScalar(values + i, out + i, length - i, min, scale);
+}
+
+void LouUI::Pixels::lookup(const uint8_t *indices, lv_color_t *out,
+                           uint32_t length, const lv_color_t *table) {
+    //neither NEON nor SSE2 can gather 32 bit entries, so this stays scalar
+    for(uint32_t i = 0; i < length; i++) out[i] = table[indices[i]];
+}
@@ -0,0 +1,115 @@
+/**
+ * @file Pixels.hpp
+ * @brief Pixels class
+ * @details Header file for the Pixels class, with the vectorized fill and blend
+ * kernels used to draw into LouUI's pixel buffers
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_PIXELS_HPP
+#define LOUUI_PIXELS_HPP
+
+#include "../../include/display/lvgl.h"
+
+namespace LouUI {
+    /**
+     * @class Pixels
+     * @brief Fills, blends and colors rows of pixels
+     * @details
+     * Used for the buffers LouUI draws into itself, like the FieldMap
+     * canvas, the Heatmap cells and the TransitionCache snapshots. With 32
+     * bit color the kernels use NEON on the brain, SSE2 on x86 hosts, and
+     * a scalar loop otherwise. The scalar versions are public so the
+     * Benchmark can compare them.
+     *
+     * Blending matches lvgl's lv_color_mix(): every channel is
+     * (src * opa + dest * (255 - opa)) >> 8 and the alpha is opaque. Like
+     * lvgl's draw functions, src is copied at LV_OPA_COVER and dest is kept
+     * at LV_OPA_TRANSP.
+     */
+    class Pixels {
+    public:
+
+        /**
+         * Fills a row of pixels with a color
+         *
+         * @param dest The first pixel
+         * @param length The number of pixels
+         * @param color The color
+         */
+        static void fill(lv_color_t *dest, uint32_t length, lv_color_t color);
+
+        /**
+         * Blends a row of pixels over another
+         *
+         * @param dest The pixels to blend onto
+         * @param src The pixels to blend
+         * @param length The number of pixels
+         * @param opa The opacity of src
+         */
+        static void blend(lv_color_t *dest, const lv_color_t *src,
+                          uint32_t length, lv_opa_t opa);
+
+        /**
+         * Converts values to indices into a 256 entry color table: min
+         * becomes 0 and min + 255 / scale becomes 255, rounded and clamped.
+         * NaN becomes 0
+         *
+         * @param values The values
+         * @param out The indices
+         * @param length The number of values
+         * @param min The value of index 0
+         * @param scale Indices per unit of value
+         */
+        static void quantize(const float *values, uint8_t *out,
+                             uint32_t length, float min, float scale);
+
+        /**
+         * Looks up colors in a 256 entry color table
+         */
+        static void lookup(const uint8_t *indices, lv_color_t *out,
+                           uint32_t length, const lv_color_t *table);
+
+        /**
+         * Fills a row of pixels one pixel at a time
+         */
+        static void fillScalar(lv_color_t *dest, uint32_t length,
+                               lv_color_t color);
+
+        /**
+         * Blends a row of pixels one pixel at a time
+         */
+        static void blendScalar(lv_color_t *dest, const lv_color_t *src,
+                                uint32_t length, lv_opa_t opa);
+
+        /**
+         * Converts values to indices one value at a time
+         */
+        static void quantizeScalar(const float *values, uint8_t *out,
+                                   uint32_t length, float min, float scale);
+    };
+}
+
+
+#endif //LOUUI_PIXELS_HPP
@@ -0,0 +1,94 @@
+/**
+ * @file RenderStats.cpp
+ * @brief Implementation of RenderStats
+ * @details Implements the RenderStats class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "RenderStats.hpp"
+#include "../../include/display/lv_core/lv_refr.h"
+#include "../../include/display/lv_objx/lv_tabview.h"
+#include <algorithm>
+
+std::unordered_map<lv_obj_t *, LouUI::RenderStats::Stats>
+        LouUI::RenderStats::stats;
+pros::Mutex *LouUI::RenderStats::mutex = nullptr;
+lv_obj_t *LouUI::RenderStats::tabView = nullptr;
+uint32_t LouUI::RenderStats::invalidations = 0;
+
+void LouUI::RenderStats::enable(lv_obj_t *tabView) {
+    RenderStats::tabView = tabView;
+    if(mutex) return;
+
+    mutex = new pros::Mutex();
+    lv_refr_set_monitor_cb(monitor);
+    //the V5 screen needs no rounding, so the hook is only used to count
+    //invalidated areas
+    lv_refr_set_round_cb(round);
+}
+
+lv_obj_t *LouUI::RenderStats::activeScreen() {
+    if(tabView){
+        return lv_tabview_get_tab(tabView, lv_tabview_get_tab_act(tabView));
+    }
+    return lv_scr_act();
+}
+
+void LouUI::RenderStats::round(lv_area_t *area) {
+    //lv_inv_area rounds every area it saves, but the refresh also calls
+    //the hook with a 0,0 to 0,rows area to round the rows of each redrawn
+    //area to the VDB, which is not an invalidation
+    if(area->x1 == 0 && area->x2 == 0 && area->y1 == 0) return;
+    invalidations++;
+}
+
+void LouUI::RenderStats::monitor(uint32_t time, uint32_t pixels) {
+    mutex->take(TIMEOUT_MAX);
+    Stats &s = stats[activeScreen()];
+    s.frames++;
+    s.totalTime += time;
+    s.maxTime = std::max(s.maxTime, time);
+    s.pixels += pixels;
+    s.invalidations += invalidations;
+    invalidations = 0;
+    mutex->give();
+}
+
+LouUI::RenderStats::Stats LouUI::RenderStats::get(lv_obj_t *screen) {
+    Stats s = {};
+    if(!mutex) return s;
+    mutex->take(TIMEOUT_MAX);
+    auto it = stats.find(screen);
+    if(it != stats.end()) s = it->second;
+    mutex->give();
+    return s;
+}
+
+void LouUI::RenderStats::reset() {
+    if(!mutex) return;
+    mutex->take(TIMEOUT_MAX);
+    stats.clear();
+    invalidations = 0;
+    mutex->give();
+}
@@ -0,0 +1,103 @@
+/**
+ * @file RenderStats.hpp
+ * @brief Render time and invalidation statistics per screen
+ * @details Contains the RenderStats class, which records how long lvgl takes to
+ * redraw each screen and how many areas were invalidated.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_RENDERSTATS_HPP
+#define LOUUI_RENDERSTATS_HPP
+
+#include <unordered_map>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+
+namespace LouUI {
+    /**
+     * @class RenderStats
+     * @brief Measures redraws of each screen
+     * @details
+     * RenderStats uses lvgl's refresh monitor to record the time and the
+     * number of pixels of every redraw, and counts every invalidated area.
+     * Redraws are attributed to the screen shown at the time: the active
+     * tab of the Display, or the active lvgl screen.
+     *
+     * Usually used through Display::enableRenderStats() and
+     * Display::printRenderStats().
+     */
+    class RenderStats {
+    public:
+
+        /**
+         * @struct Stats
+         * @brief Totals for one screen
+         */
+        struct Stats {
+            /**Number of redraws*/
+            uint32_t frames;
+            /**Total redraw time in milliseconds*/
+            uint32_t totalTime;
+            /**Longest redraw in milliseconds*/
+            uint32_t maxTime;
+            /**Total number of redrawn pixels*/
+            uint64_t pixels;
+            /**Areas passed to lv_inv_area, before lvgl joins them*/
+            uint32_t invalidations;
+        };
+
+    private:
+        static std::unordered_map<lv_obj_t *, Stats> stats;
+        static pros::Mutex *mutex;
+        static lv_obj_t *tabView;
+        static uint32_t invalidations;
+
+        static void monitor(uint32_t time, uint32_t pixels);
+        static void round(lv_area_t *area);
+        static lv_obj_t *activeScreen();
+
+    public:
+
+        /**
+         * Starts recording
+         * @param tabView the tab view whose tabs are the screens, or nullptr
+         * to use lvgl screens
+         */
+        static void enable(lv_obj_t *tabView = nullptr);
+
+        /**
+         * Gets the totals of a screen
+         */
+        static Stats get(lv_obj_t *screen);
+
+        /**
+         * Clears the totals of every screen
+         */
+        static void reset();
+    };
+}
+
+
+#endif //LOUUI_RENDERSTATS_HPP
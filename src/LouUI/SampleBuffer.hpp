@@ -0,0 +1,109 @@
+/**
+ * @file SampleBuffer.hpp
+ * @brief Lock-free buffer for passing samples to the UI
+ * @details Contains the SampleBuffer class, a fixed-size single producer,
+ * single consumer ring buffer that lets a control loop hand samples to the UI
+ * without locking.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_SAMPLEBUFFER_HPP
+#define LOUUI_SAMPLEBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace LouUI {
+    /**
+     * @class SampleBuffer
+     * @brief Single producer, single consumer ring buffer
+     * @details
+     * One task pushes samples and one task pops them. Neither side ever
+     * blocks or allocates: push() drops the sample when the buffer is full,
+     * and pop() returns false when it is empty, so a control loop that
+     * pushes samples keeps its timing no matter how slowly the UI drains
+     * them.
+     * @tparam T The sample type, which should be trivially copyable
+     * @tparam N The capacity, which must be a power of two
+     */
+    template <typename T, std::size_t N>
+    class SampleBuffer {
+        static_assert(N > 0 && (N & (N - 1)) == 0,
+                      "SampleBuffer capacity must be a power of two");
+
+    private:
+        T samples[N];
+        std::atomic<uint32_t> head{0};
+        std::atomic<uint32_t> tail{0};
+        std::atomic<uint32_t> dropped{0};
+
+    public:
+
+        /**
+         * Adds a sample. Only called by the producer.
+         * @return false if the buffer was full and the sample was dropped
+         */
+        bool push(const T &sample) {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            if(h - tail.load(std::memory_order_acquire) == N){
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            samples[h & (N - 1)] = sample;
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Removes the oldest sample. Only called by the consumer.
+         * @param sample Set to the removed sample
+         * @return false if the buffer was empty
+         */
+        bool pop(T &sample) {
+            uint32_t t = tail.load(std::memory_order_relaxed);
+            if(t == head.load(std::memory_order_acquire)) return false;
+            sample = samples[t & (N - 1)];
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Gets the number of samples waiting to be popped
+         */
+        std::size_t size() const {
+            return head.load(std::memory_order_acquire) -
+                   tail.load(std::memory_order_acquire);
+        }
+
+        /**
+         * Gets the number of samples dropped because the buffer was full
+         */
+        uint32_t getDropped() const {
+            return dropped.load(std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif //LOUUI_SAMPLEBUFFER_HPP
@@ -0,0 +1,183 @@
+/**
+ * @file ScreenMirror.cpp
+ * @brief Implementation of ScreenMirror
+ * @details Implements the ScreenMirror class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ScreenMirror.hpp"
+#include <cstdio>
+
+lv_disp_t *LouUI::ScreenMirror::next = nullptr;
+lv_disp_t *LouUI::ScreenMirror::mirror = nullptr;
+std::atomic<bool> LouUI::ScreenMirror::running{false};
+std::vector<uint8_t> LouUI::ScreenMirror::queue;
+std::vector<uint8_t> LouUI::ScreenMirror::pending;
+uint8_t *LouUI::ScreenMirror::encoded = nullptr;
+pros::Mutex *LouUI::ScreenMirror::mutex = nullptr;
+pros::Task *LouUI::ScreenMirror::writer = nullptr;
+std::atomic<bool> LouUI::ScreenMirror::resend{false};
+std::atomic<uint32_t> LouUI::ScreenMirror::sent{0};
+std::atomic<uint32_t> LouUI::ScreenMirror::dropped{0};
+
+static void put16(uint8_t *out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+void LouUI::ScreenMirror::encode(int32_t x1, int32_t y1, int32_t x2,
+                                 int32_t y2, const lv_color_t *pixels) {
+    uint32_t count = (x2 - x1 + 1) * (y2 - y1 + 1);
+    //areas come from the VDB, anything larger is not a screen flush
+    if(count > LV_VDB_SIZE) return;
+    uint8_t *frame = encoded;
+    frame[0] = 'L';
+    frame[1] = 'M';
+    frame[2] = 1;
+    put16(frame + 3, x1);
+    put16(frame + 5, y1);
+    put16(frame + 7, x2 - x1 + 1);
+    put16(frame + 9, y2 - y1 + 1);
+
+    //runs of the same color, alpha is dropped. Noisy areas take more
+    //bytes as runs than as raw pixels, so they are sent raw instead
+    uint32_t raw = count * 3;
+    uint32_t length = 0;
+    uint8_t *out = frame + 15;
+    for(uint32_t i = 0; i < count && length < raw;){
+        uint32_t run = 1;
+        while(run < 256 && i + run < count &&
+              pixels[i + run].full == pixels[i].full){
+            run++;
+        }
+        out[length++] = run - 1;
+        out[length++] = pixels[i].blue;
+        out[length++] = pixels[i].green;
+        out[length++] = pixels[i].red;
+        i += run;
+    }
+    if(length >= raw){
+        frame[2] = 2;
+        length = 0;
+        for(uint32_t i = 0; i < count; i++){
+            out[length++] = pixels[i].blue;
+            out[length++] = pixels[i].green;
+            out[length++] = pixels[i].red;
+        }
+    }
+
+    uint16_t sum = 0;
+    for(uint32_t i = 0; i < length; i++) sum += out[i];
+    for(int i = 0; i < 4; i++) frame[11 + i] = (length >> (8 * i)) & 0xFF;
+    put16(out + length, sum);
+    size_t size = 15 + length + 2;
+
+    //both queues were reserved to MAX_BACKLOG, so this never allocates
+    mutex->take(TIMEOUT_MAX);
+    bool overflow = queue.size() + size > MAX_BACKLOG;
+    if(overflow) queue.clear();
+    else queue.insert(queue.end(), frame, frame + size);
+    mutex->give();
+
+    //the areas in the dropped frames are unknown, so send everything again
+    if(overflow){
+        dropped++;
+        resend = true;
+    }
+}
+
+void LouUI::ScreenMirror::resendTask(void *param) {
+    //invalidating inside a refresh would be lost, so it is done here
+    if(resend.exchange(false)) lv_obj_invalidate(lv_scr_act());
+}
+
+void LouUI::ScreenMirror::flush(int32_t x1, int32_t y1, int32_t x2,
+                                int32_t y2, const lv_color_t *pixels) {
+    if(running) encode(x1, y1, x2, y2, pixels);
+    next->driver.disp_flush(x1, y1, x2, y2, pixels);
+}
+
+void LouUI::ScreenMirror::fill(int32_t x1, int32_t y1, int32_t x2,
+                               int32_t y2, lv_color_t color) {
+    if(next->driver.disp_fill){
+        next->driver.disp_fill(x1, y1, x2, y2, color);
+    }
+}
+
+void LouUI::ScreenMirror::map(int32_t x1, int32_t y1, int32_t x2,
+                              int32_t y2, const lv_color_t *pixels) {
+    if(next->driver.disp_map){
+        next->driver.disp_map(x1, y1, x2, y2, pixels);
+    }
+}
+
+void LouUI::ScreenMirror::writeTask(void *param) {
+    while(true){
+        mutex->take(TIMEOUT_MAX);
+        pending.swap(queue);
+        mutex->give();
+        if(!pending.empty()){
+            std::fwrite(pending.data(), 1, pending.size(), stdout);
+            std::fflush(stdout);
+            sent += pending.size();
+            pending.clear();
+        }
+        pros::delay(20);
+    }
+}
+
+void LouUI::ScreenMirror::enable() {
+    if(!mirror){
+        mutex = new pros::Mutex();
+        //a run of one pixel takes four bytes, more than a raw pixel
+        encoded = new uint8_t[15 + LV_VDB_SIZE * 4 + 2];
+        queue.reserve(MAX_BACKLOG);
+        pending.reserve(MAX_BACKLOG);
+        next = lv_disp_get_active();
+        lv_disp_drv_t driver;
+        lv_disp_drv_init(&driver);
+        driver.disp_flush = flush;
+        driver.disp_fill = fill;
+        driver.disp_map = map;
+        mirror = lv_disp_drv_register(&driver);
+        lv_disp_set_active(mirror);
+        writer = new pros::Task(writeTask, nullptr, TASK_PRIORITY_MIN + 1,
+                                TASK_STACK_DEPTH_DEFAULT, "LouUI mirror");
+        lv_task_create(resendTask, 100, LV_TASK_PRIO_LOW, nullptr);
+    }
+    running = true;
+    lv_obj_invalidate(lv_scr_act());
+}
+
+void LouUI::ScreenMirror::disable() {
+    running = false;
+}
+
+uint32_t LouUI::ScreenMirror::getSent() {
+    return sent;
+}
+
+uint32_t LouUI::ScreenMirror::getDropped() {
+    return dropped;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file ScreenMirror.hpp
+ * @brief ScreenMirror class
+ * @details Header file for the ScreenMirror class, which streams the redrawn
+ * areas of the brain screen over the USB serial link
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_SCREENMIRROR_HPP
+#define LOUUI_SCREENMIRROR_HPP
+
+#include <atomic>
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+
+namespace LouUI {
+    /**
+     * @class ScreenMirror
+     * @brief Streams the screen to a computer over USB
+     * @details
+     * When enabled, the ScreenMirror wraps the active display driver and
+     * encodes every area lvgl redraws before passing it on. Only redrawn
+     * areas are sent, so the bandwidth follows what changed on the screen.
+     * The first frame after enabling is the whole screen.
+     *
+     * Each area is written to stdout as one frame, little endian:
+     * | bytes | content                                        |
+     * |-------|------------------------------------------------|
+     * | 2     | magic "LM"                                     |
+     * | 1     | frame type, 1 for runs, 2 for raw pixels       |
+     * | 8     | x, y, width and height, 16 bits each            |
+     * | 4     | length of the data                             |
+     * | n     | runs: count - 1, then blue, green and red, or  |
+     * |       | raw pixels: blue, green and red                |
+     * | 2     | sum of the data bytes, modulo 65536            |
+     *
+     * An area is sent raw when its runs would not be smaller.
+     *
+     * Frames are queued by the lvgl task and written by a separate task.
+     * If the serial link falls more than MAX_BACKLOG bytes behind, the
+     * queue is dropped and the whole screen is sent again.
+     * tools/mirror.py decodes the stream into an image on the computer.
+     */
+    class ScreenMirror {
+    public:
+        /**Bytes that may wait to be written before frames are dropped*/
+        static constexpr uint32_t MAX_BACKLOG = 256 * 1024;
+
+    private:
+        static lv_disp_t *next;
+        static lv_disp_t *mirror;
+        static std::atomic<bool> running;
+        static std::vector<uint8_t> queue;
+        static std::vector<uint8_t> pending;
+        static uint8_t *encoded;
+        static pros::Mutex *mutex;
+        static pros::Task *writer;
+        static std::atomic<bool> resend;
+        static std::atomic<uint32_t> sent;
+        static std::atomic<uint32_t> dropped;
+
+        static void encode(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                           const lv_color_t *pixels);
+        static void flush(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                          const lv_color_t *pixels);
+        static void fill(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                         lv_color_t color);
+        static void map(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                        const lv_color_t *pixels);
+        static void writeTask(void *param);
+        static void resendTask(void *param);
+
+    public:
+
+        /**
+         * Starts mirroring, beginning with the whole screen
+         */
+        static void enable();
+
+        /**
+         * Stops mirroring. The driver stays in place and passes areas on
+         */
+        static void disable();
+
+        /**
+         * Gets the number of bytes written to the serial link
+         */
+        static uint32_t getSent();
+
+        /**
+         * Gets the number of times the queue was dropped
+         */
+        static uint32_t getDropped();
+    };
+}
+
+
+#endif //LOUUI_SCREENMIRROR_HPP
@@ -0,0 +1,287 @@
+/**
+ * @file SelectorGrid.cpp
+ * @brief Implementation of SelectorGrid
+ * @details Implements the SelectorGrid class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "SelectorGrid.hpp"
+#include "Memory.hpp"
+#include "../../include/display/lv_objx/lv_btnm.h"
+#include <stdexcept>
+
+lv_signal_func_t LouUI::SelectorGrid::ancestorSignal = nullptr;
+
+LouUI::SelectorGrid::SelectorGrid(lv_obj_t *parent)
+        : columns(1), selected(-1) {
+    obj = lv_btnm_create(parent, nullptr);
+    lv_obj_set_free_ptr(obj, this);
+    lv_btnm_set_action(obj, dispatch);
+    if(!ancestorSignal) ancestorSignal = lv_obj_get_signal_func(obj);
+    lv_obj_set_signal_func(obj, signal);
+
+    lv_style_t *styles[6];
+    const lv_style_t *defaults[6] = {
+            &lv_style_transp_fit, &lv_style_btn_rel, &lv_style_btn_pr,
+            &lv_style_btn_tgl_rel, &lv_style_btn_tgl_pr, &lv_style_btn_ina
+    };
+    for(int i = 0; i < 6; i++){
+        styles[i] = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                 "SelectorGrid", obj));
+        lv_style_copy(styles[i], defaults[i]);
+    }
+    backgroundStyle = styles[0];
+    releasedStyle = styles[1];
+    pressedStyle = styles[2];
+    toggledReleasedStyle = styles[3];
+    toggledPressedStyle = styles[4];
+    inactiveStyle = styles[5];
+
+    lv_btnm_set_style(obj, LV_BTNM_STYLE_BG, backgroundStyle);
+    lv_btnm_set_style(obj, LV_BTNM_STYLE_BTN_REL, releasedStyle);
+    lv_btnm_set_style(obj, LV_BTNM_STYLE_BTN_PR, pressedStyle);
+    lv_btnm_set_style(obj, LV_BTNM_STYLE_BTN_TGL_REL, toggledReleasedStyle);
+    lv_btnm_set_style(obj, LV_BTNM_STYLE_BTN_TGL_PR, toggledPressedStyle);
+    lv_btnm_set_style(obj, LV_BTNM_STYLE_BTN_INA, inactiveStyle);
+}
+
+std::vector<lv_style_t *>
+LouUI::SelectorGrid::getStyles(LouUI::SelectorGrid::State s) {
+    switch(s){
+        case RELEASED: return {releasedStyle};
+        case PRESSED: return {pressedStyle};
+        case TOGGLED_RELEASED: return {toggledReleasedStyle};
+        case TOGGLED_PRESSED: return {toggledPressedStyle};
+        case INACTIVE: return {inactiveStyle};
+        case ALL_RELEASED: return {releasedStyle, toggledReleasedStyle};
+        case ALL_PRESSED: return {pressedStyle, toggledPressedStyle};
+        case ALL_UNTOGGLED: return {releasedStyle, pressedStyle};
+        case ALL_TOGGLED: return {toggledReleasedStyle, toggledPressedStyle};
+        case ALL: return {releasedStyle, pressedStyle, toggledReleasedStyle,
+                          toggledPressedStyle, inactiveStyle};
+    }
+    return {};
+}
+
+void LouUI::SelectorGrid::buildMap() {
+    //the entries point into text, which holds every label and its
+    //control byte: 0x80 for a normal choice, with the inactive bit set for
+    //a disabled one
+    map.clear();
+    size_t start = 0;
+    for(size_t i = 0; i < inactive.size(); i++){
+        if(i > 0 && i % columns == 0) map.push_back("\n");
+        text[start] = (char)(LV_BTNM_CTRL_CODE |
+                             (inactive[i] ? LV_BTNM_INACTIVE_MASK : 0) | 1);
+        map.push_back(&text[start]);
+        start = text.find('\0', start) + 1;
+    }
+    map.push_back("");
+    lv_btnm_set_map(obj, map.data());
+    setSelected(selected);
+}
+
+int LouUI::SelectorGrid::getIndex(const char *txt) {
+    //lvgl passes the label after the control byte
+    int index = 0;
+    for(const char *entry : map){
+        if(entry[0] == '\n') continue;
+        if(entry + 1 == txt) return index;
+        index++;
+    }
+    return -1;
+}
+
+lv_res_t LouUI::SelectorGrid::dispatch(lv_obj_t *btnm, const char *txt) {
+    auto *grid = (SelectorGrid *)lv_obj_get_free_ptr(btnm);
+    int index = grid->getIndex(txt);
+    if(index < 0 || grid->inactive[index]) return LV_RES_OK;
+    grid->selected = index;
+    if(grid->action) grid->action(index);
+    return LV_RES_OK;
+}
+
+lv_res_t LouUI::SelectorGrid::signal(lv_obj_t *btnm, lv_signal_t sign,
+                                     void *param) {
+    lv_res_t res = ancestorSignal(btnm, sign, param);
+    if(res != LV_RES_OK) return res;
+    if(sign != LV_SIGNAL_RELEASED && sign != LV_SIGNAL_PRESS_LOST){
+        return res;
+    }
+
+    //the btnm toggles any released button, even inactive ones and after
+    //the action ignored it, so the selection is toggled again
+    auto *grid = (SelectorGrid *)lv_obj_get_free_ptr(btnm);
+    uint16_t selected = grid->selected < 0 ? LV_BTNM_PR_NONE :
+                        (uint16_t)grid->selected;
+    if(lv_btnm_get_toggled(btnm) != selected){
+        lv_btnm_set_toggle(btnm, true, selected);
+    }
+    return res;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::setOptions(const std::vector<std::string> &options,
+                                int columns) {
+    if(columns < 1) throw std::invalid_argument("Grid needs a column");
+    SelectorGrid::columns = columns;
+    text.clear();
+    for(const std::string &o : options){
+        text += ' ';
+        text += o;
+        text += '\0';
+    }
+    inactive.assign(options.size(), false);
+    if(selected >= (int)options.size()) selected = -1;
+    buildMap();
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setAction(Action a) {
+    action = std::move(a);
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setSelected(int index) {
+    if(index >= (int)inactive.size()){
+        throw std::invalid_argument("Choice does not exist");
+    }
+    selected = index;
+    lv_btnm_set_toggle(obj, true, index < 0 ? LV_BTNM_PR_NONE : index);
+    return this;
+}
+
+int LouUI::SelectorGrid::getSelected() {
+    return selected;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setEnabled(int index,
+                                                     bool enabled) {
+    if(index < 0 || index >= (int)inactive.size()){
+        throw std::invalid_argument("Choice does not exist");
+    }
+    inactive[index] = !enabled;
+    buildMap();
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setWidth(int width) {
+    lv_obj_set_width(obj, width);
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setHeight(int height) {
+    lv_obj_set_height(obj, height);
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setSize(int width, int height) {
+    lv_obj_set_size(obj, width, height);
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setPosition(int x, int y) {
+    lv_obj_set_pos(obj, x, y);
+    return this;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::align(lv_obj_t *ref, LouUI::Align alignType, int xShift,
+                           int yShift) {
+    lv_obj_align(obj, ref, alignType, xShift, yShift);
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setBackgroundColor(LouUI::Color c) {
+    backgroundStyle->body.main_color = c.toLvColor();
+    backgroundStyle->body.grad_color = c.toLvColor();
+    backgroundStyle->body.empty = 0;
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+LouUI::SelectorGrid *LouUI::SelectorGrid::setSpacing(int outside,
+                                                     int between) {
+    backgroundStyle->body.padding.hor = outside;
+    backgroundStyle->body.padding.ver = outside;
+    backgroundStyle->body.padding.inner = between;
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::setMainColor(LouUI::Color c,
+                                  LouUI::SelectorGrid::State s) {
+    for(lv_style_t *style : getStyles(s)){
+        style->body.main_color = c.toLvColor();
+    }
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::setGradientColor(LouUI::Color c,
+                                      LouUI::SelectorGrid::State s) {
+    for(lv_style_t *style : getStyles(s)){
+        style->body.grad_color = c.toLvColor();
+    }
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::setTextColor(LouUI::Color c,
+                                  LouUI::SelectorGrid::State s) {
+    for(lv_style_t *style : getStyles(s)) style->text.color = c.toLvColor();
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::setBorderColor(LouUI::Color c,
+                                    LouUI::SelectorGrid::State s) {
+    for(lv_style_t *style : getStyles(s)){
+        style->body.border.color = c.toLvColor();
+    }
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::setBorderWidth(int w, LouUI::SelectorGrid::State s) {
+    for(lv_style_t *style : getStyles(s)) style->body.border.width = w;
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+LouUI::SelectorGrid *
+LouUI::SelectorGrid::setRadius(int r, LouUI::SelectorGrid::State s) {
+    for(lv_style_t *style : getStyles(s)) style->body.radius = r;
+    lv_obj_refresh_style(obj);
+    return this;
+}
+
+lv_obj_t *LouUI::SelectorGrid::getObj() {
+    return obj;
+}
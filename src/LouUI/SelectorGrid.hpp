@@ -0,0 +1,215 @@
+/**
+ * @file SelectorGrid.hpp
+ * @brief SelectorGrid class
+ * @details Header file for the SelectorGrid class, a grid of choices drawn by a
+ * single lvgl button matrix
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_SELECTORGRID_HPP
+#define LOUUI_SELECTORGRID_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+#include "Align.hpp"
+#include "Color.hpp"
+#include "ToggleButton.hpp"
+
+namespace LouUI {
+    /**
+     * @class SelectorGrid
+     * @brief A grid of choices, one of which is selected
+     * @details
+     * A SelectorGrid is a single lvgl button matrix, so every choice shares
+     * one object and one set of styles. The labels are packed into one
+     * string that the button map points into, so a choice costs its text
+     * and a pointer instead of a button, a label and five styles.
+     * @subsection usage Usage
+     * @code
+     * LouUI::SelectorGrid *routines = (new LouUI::SelectorGrid(screen))
+     *         ->setOptions({"1", "2", "3", "4", "5", "6", "7", "8"}, 4)
+     *         ->setSize(440, 100)
+     *         ->setMainColor(LouUI::Color(0, 125, 0),
+     *                        LouUI::SelectorGrid::ALL_TOGGLED)
+     *         ->setAction([](int index){ selectRoutine(index); });
+     * @endcode
+     */
+    class SelectorGrid {
+    public:
+
+        using State = ToggleButton::State;
+        static constexpr State RELEASED = ToggleButton::RELEASED;
+        static constexpr State PRESSED = ToggleButton::PRESSED;
+        static constexpr State TOGGLED_RELEASED =
+                ToggleButton::TOGGLED_RELEASED;
+        static constexpr State TOGGLED_PRESSED = ToggleButton::TOGGLED_PRESSED;
+        static constexpr State INACTIVE = ToggleButton::INACTIVE;
+        static constexpr State ALL_RELEASED = ToggleButton::ALL_RELEASED;
+        static constexpr State ALL_PRESSED = ToggleButton::ALL_PRESSED;
+        static constexpr State ALL_UNTOGGLED = ToggleButton::ALL_UNTOGGLED;
+        static constexpr State ALL_TOGGLED = ToggleButton::ALL_TOGGLED;
+        static constexpr State ALL = ToggleButton::ALL;
+
+        /**
+         * Called with the index of the choice that was selected
+         */
+        using Action = std::function<void(int index)>;
+
+    private:
+        lv_obj_t *obj;
+        lv_style_t *backgroundStyle;
+        lv_style_t *releasedStyle;
+        lv_style_t *pressedStyle;
+        lv_style_t *toggledReleasedStyle;
+        lv_style_t *toggledPressedStyle;
+        lv_style_t *inactiveStyle;
+
+        std::string text;
+        std::vector<const char *> map;
+        std::vector<bool> inactive;
+        int columns;
+        int selected;
+        Action action;
+
+        std::vector<lv_style_t *> getStyles(State s);
+        void buildMap();
+        int getIndex(const char *txt);
+
+        static lv_signal_func_t ancestorSignal;
+
+        static lv_res_t dispatch(lv_obj_t *btnm, const char *txt);
+        static lv_res_t signal(lv_obj_t *btnm, lv_signal_t sign,
+                               void *param);
+
+    public:
+
+        /**
+         * Creates a new selector grid
+         * @param parent The object the grid is created in
+         */
+        explicit SelectorGrid(lv_obj_t *parent);
+
+        /**
+         * Sets the choices, filled in row by row
+         * @param options The text of each choice
+         * @param columns The number of choices in each row
+         */
+        SelectorGrid* setOptions(const std::vector<std::string> &options,
+                                 int columns);
+
+        /**
+         * Sets the function called when a choice is selected
+         */
+        SelectorGrid* setAction(Action a);
+
+        /**
+         * Selects a choice without calling the action
+         * @param index The choice, or -1 to select none
+         */
+        SelectorGrid* setSelected(int index);
+
+        /**
+         * Gets the selected choice, or -1 if none is selected
+         */
+        int getSelected();
+
+        /**
+         * Sets whether a choice can be selected
+         */
+        SelectorGrid* setEnabled(int index, bool enabled);
+
+        SelectorGrid* setWidth(int width);
+
+        SelectorGrid* setHeight(int height);
+
+        SelectorGrid* setSize(int width, int height);
+
+        SelectorGrid* setPosition(int x, int y);
+
+        /**
+         * Aligns the grid
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift pixels to shift in the x-direction
+         * @param yShift pixels to shift in the y-direction
+         */
+        SelectorGrid* align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                            int yShift = 0);
+
+        /**
+         * Sets the color behind the choices
+         */
+        SelectorGrid* setBackgroundColor(LouUI::Color c);
+
+        /**
+         * Sets the space around and between the choices
+         */
+        SelectorGrid* setSpacing(int outside, int between);
+
+        /**
+         * Sets the main color of the choices
+         * @param s The state to be modified. Use ALL to set for all
+         */
+        SelectorGrid* setMainColor(LouUI::Color c, State s);
+
+        /**
+         * Sets the gradient color of the choices
+         * @param s The state to be modified. Use ALL to set for all
+         */
+        SelectorGrid* setGradientColor(LouUI::Color c, State s);
+
+        /**
+         * Sets the text color of the choices
+         * @param s The state to be modified. Use ALL to set for all
+         */
+        SelectorGrid* setTextColor(LouUI::Color c, State s);
+
+        /**
+         * Sets the border color of the choices
+         * @param s The state to be modified. Use ALL to set for all
+         */
+        SelectorGrid* setBorderColor(LouUI::Color c, State s);
+
+        /**
+         * Sets the border width of the choices
+         * @param s The state to be modified. Use ALL to set for all
+         */
+        SelectorGrid* setBorderWidth(int w, State s);
+
+        /**
+         * Sets the corner radius of the choices
+         * @param s The state to be modified. Use ALL to set for all
+         */
+        SelectorGrid* setRadius(int r, State s);
+
+        lv_obj_t *getObj();
+    };
+}
+
+
+#endif //LOUUI_SELECTORGRID_HPP
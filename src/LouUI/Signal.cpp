@@ -0,0 +1,79 @@
+/**
+ * @file Signal.cpp
+ * @brief Implementation of SignalBase
+ * @details Implements the flushing of Signals
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Signal.hpp"
+#include "Governor.hpp"
+#include <algorithm>
+
+std::vector<LouUI::SignalBase *> LouUI::SignalBase::queue;
+//created before any task can mark a signal dirty
+pros::Mutex *LouUI::SignalBase::mutex = new pros::Mutex();
+lv_task_t *LouUI::SignalBase::task = nullptr;
+
+LouUI::SignalBase::~SignalBase() {
+    lock();
+    queue.erase(std::remove(queue.begin(), queue.end(), this), queue.end());
+    unlock();
+}
+
+void LouUI::SignalBase::lock() {
+    mutex->take(TIMEOUT_MAX);
+}
+
+void LouUI::SignalBase::unlock() {
+    mutex->give();
+}
+
+void LouUI::SignalBase::markDirty() {
+    Governor::markDirty();
+    if(queued) return;
+    queued = true;
+    queue.push_back(this);
+}
+
+void LouUI::SignalBase::start() {
+    if(task) return;
+    //higher priority than the refresh task, so it runs right before it
+    task = lv_task_create(flushTask, 40, LV_TASK_PRIO_HIGH, nullptr);
+}
+
+void LouUI::SignalBase::flushTask(void *param) {
+    flush();
+}
+
+void LouUI::SignalBase::flush() {
+    std::vector<SignalBase *> dirty;
+    lock();
+    dirty.swap(queue);
+    for(SignalBase *s : dirty){
+        s->queued = false;
+        s->capture();
+    }
+    unlock();
+    for(SignalBase *s : dirty) s->apply();
+}
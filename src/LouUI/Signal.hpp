@@ -0,0 +1,319 @@
+/**
+ * @file Signal.hpp
+ * @brief Observable values bound to UI elements
+ * @details Contains the Signal class, a value that updates the Labels, Gauges
+ * and Charts bound to it once per frame, and only when it has changed enough.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_SIGNAL_HPP
+#define LOUUI_SIGNAL_HPP
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+#include "Chart.hpp"
+#include "ControllerView.hpp"
+#include "Gauge.hpp"
+#include "Label.hpp"
+
+namespace LouUI {
+    /**
+     * @class SignalBase
+     * @brief Flushes every changed Signal once per frame
+     * @details
+     * Setting a Signal only queues it. Right before each screen refresh, a
+     * single lvgl task copies the values of the queued signals and applies
+     * them to their bindings, so a value set many times in one frame updates
+     * its elements at most once.
+     */
+    class SignalBase {
+    private:
+        static std::vector<SignalBase *> queue;
+        static pros::Mutex *mutex;
+        static lv_task_t *task;
+
+        bool queued = false;
+
+        static void flushTask(void *param);
+
+    protected:
+        /**
+         * Creates the flush task if it does not exist yet. Called when a
+         * binding is added, from the task that builds the UI.
+         */
+        static void start();
+
+        /**
+         * Locks the values of every signal
+         */
+        static void lock();
+
+        /**
+         * Unlocks the values of every signal
+         */
+        static void unlock();
+
+        /**
+         * Queues the signal for the next flush. Called while locked.
+         */
+        void markDirty();
+
+        /**
+         * Copies the value to be applied. Called while locked.
+         */
+        virtual void capture() = 0;
+
+        /**
+         * Applies the captured value to the bindings. Called in the lvgl
+         * task, while unlocked.
+         */
+        virtual void apply() = 0;
+
+    public:
+        SignalBase() = default;
+        SignalBase(const SignalBase &) = delete;
+        SignalBase &operator=(const SignalBase &) = delete;
+        virtual ~SignalBase();
+
+        /**
+         * Applies every queued signal now instead of before the next
+         * refresh. Must be called from the lvgl task.
+         */
+        static void flush();
+    };
+
+    /**
+     * @class Signal
+     * @brief Value that updates the UI elements bound to it
+     * @details
+     * A Signal can be set from any task, e.g. the opcontrol loop, instead of
+     * calling setText or addData on every element that shows the value.
+     * Each binding has an epsilon: the element is only updated when the
+     * value has moved more than epsilon from the value the element last
+     * showed, which avoids redrawing elements for noise. Values that are not
+     * numbers are compared with !=.
+     *
+     * Bindings are added from the task that builds the UI. They are queued
+     * and moved in by the lvgl task, where they run.
+     * @subsection usage Usage
+     * @code
+     * LouUI::Signal<double> temperature;
+     * temperature.bind(tempLabel, "Temp: %.0f C", 1)
+     *         ->bind(tempGauge, 1);
+     *
+     * //opcontrol
+     * temperature.set(motor.get_temperature());
+     * @endcode
+     * @tparam T The type of the value, which must be copyable
+     */
+    template <typename T>
+    class Signal : public SignalBase {
+    public:
+
+        /**
+         * Shows a new value
+         */
+        using Apply = std::function<void(const T &)>;
+
+    private:
+        struct Binding {
+            Apply apply;
+            double epsilon;
+            bool everySet;
+            T last;
+            bool applied;
+        };
+
+        T value;
+        T captured;
+        bool setSinceFlush = false;
+        bool capturedSet = false;
+        std::vector<Binding> bindings;
+        std::vector<Binding> newBindings;
+
+        static bool exceeds(const T &a, const T &b, double epsilon) {
+            if constexpr(std::is_arithmetic<T>::value){
+                return std::fabs((double)a - (double)b) > epsilon;
+            }else{
+                return a != b;
+            }
+        }
+
+        Signal *addBinding(Binding b) {
+            start();
+            lock();
+            newBindings.push_back(std::move(b));
+            markDirty();
+            unlock();
+            return this;
+        }
+
+        void capture() override {
+            //only the lvgl task uses bindings, so apply can run unlocked
+            for(Binding &b : newBindings) bindings.push_back(std::move(b));
+            newBindings.clear();
+            captured = value;
+            capturedSet = setSinceFlush;
+            setSinceFlush = false;
+        }
+
+        void apply() override {
+            for(Binding &b : bindings){
+                bool changed = b.everySet ? capturedSet :
+                               !b.applied || exceeds(captured, b.last,
+                                                     b.epsilon);
+                if(!changed) continue;
+                b.last = captured;
+                b.applied = true;
+                b.apply(captured);
+            }
+        }
+
+    public:
+
+        /**
+         * Creates a new signal
+         * @param initial The initial value, shown by bindings added before
+         * the first set
+         */
+        explicit Signal(T initial = T()) : value(initial), captured(initial) {}
+
+        ~Signal() override = default;
+
+        /**
+         * Sets the value. Bound elements are updated before the next
+         * refresh.
+         */
+        Signal *set(T v) {
+            lock();
+            value = std::move(v);
+            setSinceFlush = true;
+            markDirty();
+            unlock();
+            return this;
+        }
+
+        /**
+         * Gets the value
+         */
+        T get() const {
+            lock();
+            T v = value;
+            unlock();
+            return v;
+        }
+
+        /**
+         * Adds a binding
+         * @param apply shows the value
+         * @param epsilon how far the value must move from the last value
+         * shown before apply is run again
+         */
+        Signal *subscribe(Apply apply, double epsilon = 0) {
+            return addBinding({std::move(apply), epsilon, false, T(),
+                               false});
+        }
+
+        /**
+         * Shows the value in a label
+         * @param label label to update
+         * @param format printf format for numbers, e.g. "%.1f". Other values
+         * are shown as they are.
+         * @param epsilon see subscribe(Apply apply, double epsilon)
+         */
+        Signal *bind(Label *label, std::string format = "%.1f",
+                     double epsilon = 0) {
+            return subscribe([label, format](const T &v){
+                if constexpr(std::is_arithmetic<T>::value){
+                    char text[64];
+                    std::snprintf(text, sizeof(text), format.c_str(),
+                                  (double)v);
+                    label->setText(text);
+                }else{
+                    label->setText(v);
+                }
+            }, epsilon);
+        }
+
+        /**
+         * Shows the value on a line of the controller screen
+         * @param view controller view to update
+         * @param row line of the controller screen, 0 to 2
+         * @param column first column of the value, 0 to 14
+         * @param format printf format for numbers, e.g. "%.1f". Other values
+         * are shown as they are.
+         * @param width columns the value owns, or 0 for the rest of the line
+         * @param epsilon see subscribe(Apply apply, double epsilon)
+         */
+        Signal *bind(ControllerView *view, int row, int column,
+                     std::string format = "%.1f", int width = 0,
+                     double epsilon = 0) {
+            if(width <= 0) width = ControllerView::COLUMNS;
+            return subscribe([view, row, column, format, width](const T &v){
+                if constexpr(std::is_arithmetic<T>::value){
+                    char text[ControllerView::COLUMNS + 1];
+                    std::snprintf(text, sizeof(text), format.c_str(),
+                                  (double)v);
+                    view->setText(row, column, text, width);
+                }else{
+                    view->setText(row, column, v, width);
+                }
+            }, epsilon);
+        }
+
+        /**
+         * Shows the value on the needle of a gauge
+         * @param gauge gauge to update
+         * @param epsilon see subscribe(Apply apply, double epsilon)
+         */
+        Signal *bind(Gauge *gauge, double epsilon = 0) {
+            return subscribe([gauge](const T &v){
+                gauge->setValue((int)std::lround((double)v));
+            }, epsilon);
+        }
+
+        /**
+         * Adds the value to a series of a chart once per frame in which the
+         * value was set
+         * @param chart chart to update
+         * @param series name of the series in the chart
+         */
+        Signal *bind(Chart *chart, std::string series) {
+            return addBinding({[chart, series](const T &v){
+                chart->addData(series, (int16_t)std::lround((double)v));
+            }, 0, true, T(), false});
+        }
+    };
+}
+
+
+#endif //LOUUI_SIGNAL_HPP
@@ -0,0 +1,171 @@
+/**
+ * @file SparklineStrip.cpp
+ * @brief Implementation of SparklineStrip
+ * @details Implements the SparklineStrip class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "SparklineStrip.hpp"
+#include "Memory.hpp"
+#include "Pixels.hpp"
+#include "../../include/display/lv_core/lv_refr.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+LouUI::SparklineStrip::SparklineStrip(lv_obj_t *parent, int count, int width,
+                                      int rowHeight)
+        : rows(new Row[std::max(count, 1)]), count(count), width(width),
+          rowHeight(rowHeight) {
+    if(count < 1 || width < 2 || rowHeight < 3){
+        throw std::invalid_argument("SparklineStrip needs rows");
+    }
+    obj = lv_canvas_create(parent, nullptr);
+    buffer = (lv_color_t *)(Memory::alloc(sizeof(lv_color_t) * width *
+                                          count * rowHeight,
+                                          "SparklineStrip", obj));
+    lv_canvas_set_buffer(obj, buffer, width, count * rowHeight,
+                         LV_IMG_CF_TRUE_COLOR);
+
+    //the gap rows are never scrolled or drawn again
+    background = Color(20, 20, 20).toLvColor();
+    Pixels::fill(buffer, width * count * rowHeight,
+                 Color(50, 50, 50).toLvColor());
+    for(int r = 0; r < count; r++){
+        rows[r].color = Color("GREEN").toLvColor();
+        for(int y = 0; y < rowHeight - 1; y++){
+            Pixels::fill(buffer + (r * rowHeight + y) * width, width,
+                         background);
+        }
+    }
+    updater = lv_task_create(update, 40, LV_TASK_PRIO_MID, this);
+}
+
+LouUI::SparklineStrip::~SparklineStrip() {
+    //the canvas draws from the buffer, so it goes first
+    lv_task_del(updater);
+    lv_obj_del(obj);
+    Memory::free(buffer);
+}
+
+void LouUI::SparklineStrip::scroll(int row, int columns) {
+    columns = std::min(columns, width);
+    for(int y = 0; y < rowHeight - 1; y++){
+        lv_color_t *line = buffer + (row * rowHeight + y) * width;
+        std::memmove(line, line + columns,
+                     sizeof(lv_color_t) * (width - columns));
+    }
+}
+
+void LouUI::SparklineStrip::draw(int row, int column, float value) {
+    Row &r = rows[row];
+    int height = rowHeight - 1;
+    float range = r.max - r.min;
+    float fraction = range != 0 ? (value - r.min) / range : 0;
+    if(!(fraction > 0)) fraction = 0;
+    if(fraction > 1) fraction = 1;
+    int y = height - 1 - (int)(fraction * (height - 1) + 0.5f);
+
+    //a vertical line from the last sample joins the points
+    int top = r.lastY < 0 ? y : std::min(y, r.lastY);
+    int bottom = r.lastY < 0 ? y : std::max(y, r.lastY);
+    lv_color_t *pixel = buffer + row * rowHeight * width + column;
+    for(int i = 0; i < height; i++, pixel += width){
+        *pixel = i >= top && i <= bottom ? r.color : background;
+    }
+    r.lastY = y;
+}
+
+void LouUI::SparklineStrip::update(void *param) {
+    auto *strip = (SparklineStrip *)param;
+    float values[32];
+    for(int row = 0; row < strip->count; row++){
+        int n = 0;
+        while(n < 32 && strip->rows[row].samples.pop(values[n])) n++;
+        if(n == 0) continue;
+
+        strip->scroll(row, n);
+        //only the newest samples fit when there are more than columns
+        int first = std::max(0, n - strip->width);
+        for(int i = first; i < n; i++){
+            strip->draw(row, strip->width - n + i, values[i]);
+        }
+
+        lv_area_t area;
+        lv_obj_get_coords(strip->obj, &area);
+        area.y1 += row * strip->rowHeight;
+        area.y2 = area.y1 + strip->rowHeight - 2;
+        lv_inv_area(&area);
+    }
+}
+
+LouUI::SparklineStrip *LouUI::SparklineStrip::add(int row, float value) {
+    if(row < 0 || row >= count){
+        throw std::invalid_argument("Row does not exist");
+    }
+    rows[row].samples.push(value);
+    return this;
+}
+
+LouUI::SparklineStrip *LouUI::SparklineStrip::setColor(int row,
+                                                       LouUI::Color c) {
+    if(row < 0 || row >= count){
+        throw std::invalid_argument("Row does not exist");
+    }
+    rows[row].color = c.toLvColor();
+    return this;
+}
+
+LouUI::SparklineStrip *LouUI::SparklineStrip::setRange(int row, float min,
+                                                       float max) {
+    if(row < 0 || row >= count){
+        throw std::invalid_argument("Row does not exist");
+    }
+    rows[row].min = min;
+    rows[row].max = max;
+    return this;
+}
+
+uint32_t LouUI::SparklineStrip::getDropped(int row) {
+    if(row < 0 || row >= count){
+        throw std::invalid_argument("Row does not exist");
+    }
+    return rows[row].samples.getDropped();
+}
+
+LouUI::SparklineStrip *LouUI::SparklineStrip::setPosition(int x, int y) {
+    lv_obj_set_pos(obj, x, y);
+    return this;
+}
+
+LouUI::SparklineStrip *
+LouUI::SparklineStrip::align(lv_obj_t *ref, LouUI::Align alignType,
+                             int xShift, int yShift) {
+    lv_obj_align(obj, ref, alignType, xShift, yShift);
+    return this;
+}
+
+lv_obj_t *LouUI::SparklineStrip::getObj() {
+    return obj;
+}
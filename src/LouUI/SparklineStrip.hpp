@@ -0,0 +1,146 @@
+/**
+ * @file SparklineStrip.hpp
+ * @brief SparklineStrip class
+ * @details Header file for the SparklineStrip class, which draws many small
+ * time-series rows into one canvas
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_SPARKLINESTRIP_HPP
+#define LOUUI_SPARKLINESTRIP_HPP
+
+#include <memory>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+#include "Align.hpp"
+#include "Color.hpp"
+#include "SampleBuffer.hpp"
+
+namespace LouUI {
+    /**
+     * @class SparklineStrip
+     * @brief Small scrolling charts, one per row, in one canvas
+     * @details
+     * Every row is a time series that scrolls to the left by one pixel per
+     * sample. add() pushes the sample into the row's SampleBuffer without
+     * blocking. An lvgl task drains the buffers, scrolls each row that got
+     * samples by moving its pixels, draws only the new columns, and
+     * invalidates only that row. A row costs its share of the canvas
+     * buffer and a small sample buffer, instead of a chart object, its
+     * style and its points.
+     *
+     * Each row has one producer: add() for a row should only be called
+     * from one task.
+     * @subsection usage Usage
+     * @code
+     * LouUI::SparklineStrip *strip = new LouUI::SparklineStrip(screen, 16,
+     *                                                          200, 12);
+     * strip->setColor(0, LouUI::Color("RED"))->setRange(0, -200, 200);
+     * //in the control loop
+     * strip->add(0, leftMotor.get_actual_velocity());
+     * @endcode
+     */
+    class SparklineStrip {
+    private:
+        struct Row {
+            SampleBuffer<float, 32> samples;
+            lv_color_t color;
+            float min = 0;
+            float max = 100;
+            int lastY = -1;
+        };
+
+        lv_obj_t *obj;
+        lv_color_t *buffer;
+        lv_color_t background;
+        lv_task_t *updater;
+        std::unique_ptr<Row[]> rows;
+        int count;
+        int width;
+        int rowHeight;
+
+        void scroll(int row, int columns);
+        void draw(int row, int column, float value);
+        static void update(void *param);
+
+    public:
+
+        /**
+         * Creates a new strip
+         * @param parent The object the strip is created in
+         * @param count The number of rows
+         * @param width The width in pixels, which is also the number of
+         * samples shown
+         * @param rowHeight The height of each row in pixels, including a
+         * one pixel gap
+         */
+        SparklineStrip(lv_obj_t *parent, int count, int width,
+                       int rowHeight = 12);
+
+        /**
+         * Deletes the canvas and frees its buffer
+         */
+        ~SparklineStrip();
+
+        /**
+         * Adds a sample to a row. Safe to call from one task per row
+         */
+        SparklineStrip* add(int row, float value);
+
+        /**
+         * Sets the line color of a row
+         */
+        SparklineStrip* setColor(int row, LouUI::Color c);
+
+        /**
+         * Sets the values at the bottom and the top of a row. Samples
+         * outside the range are drawn at the edge
+         */
+        SparklineStrip* setRange(int row, float min, float max);
+
+        /**
+         * Gets the number of samples of a row dropped because the strip
+         * was not drawn in time
+         */
+        uint32_t getDropped(int row);
+
+        SparklineStrip* setPosition(int x, int y);
+
+        /**
+         * Aligns the strip
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift pixels to shift in the x-direction
+         * @param yShift pixels to shift in the y-direction
+         */
+        SparklineStrip* align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                              int yShift = 0);
+
+        lv_obj_t *getObj();
+    };
+}
+
+
+#endif //LOUUI_SPARKLINESTRIP_HPP
@@ -0,0 +1,227 @@
+/**
+ * @file Telemetry.cpp
+ * @brief Implementation of Telemetry
+ * @details Implements the Telemetry class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "Telemetry.hpp"
+#include "Governor.hpp"
+#include "TelemetryStream.hpp"
+#include <cstdio>
+#include <stdexcept>
+
+std::vector<LouUI::Telemetry::Channel> LouUI::Telemetry::channels;
+std::vector<LouUI::Telemetry::Binding> LouUI::Telemetry::bindings;
+std::vector<LouUI::Telemetry::Binding> LouUI::Telemetry::newBindings;
+LouUI::Telemetry::Snapshot LouUI::Telemetry::snapshots[2];
+std::atomic<uint32_t> LouUI::Telemetry::published{0};
+pros::Mutex *LouUI::Telemetry::mutex = nullptr;
+pros::Task *LouUI::Telemetry::task = nullptr;
+lv_task_t *LouUI::Telemetry::bindingTask = nullptr;
+uint32_t LouUI::Telemetry::period = 20;
+
+void LouUI::Telemetry::start(uint32_t period) {
+    Telemetry::period = period;
+    if(task) return;
+
+    mutex = new pros::Mutex();
+    task = new pros::Task(sampleTask, nullptr, TASK_PRIORITY_DEFAULT,
+                          TASK_STACK_DEPTH_DEFAULT, "LouUI telemetry");
+}
+
+void LouUI::Telemetry::sampleTask(void *param) {
+    uint32_t now = pros::millis();
+    while(true){
+        //fill the half readers are not using, then publish it
+        uint32_t next = published.load(std::memory_order_relaxed) + 1;
+        Snapshot &s = snapshots[next & 1];
+        const Snapshot &last = snapshots[(next + 1) & 1];
+        bool changed = false;
+        //readers of this half saw the last publish and retry, so it may
+        //only be written after that publish
+        std::atomic_thread_fence(std::memory_order_release);
+        mutex->take(TIMEOUT_MAX);
+        for(size_t i = 0; i < channels.size(); i++){
+            s.values[i] = channels[i].read();
+            //only a channel shown on the screen makes the UI redraw
+            if(channels[i].bound && s.values[i] != last.values[i]){
+                changed = true;
+            }
+        }
+        s.count = (int)channels.size();
+        mutex->give();
+        if(changed) Governor::markDirty();
+        s.time = pros::millis();
+        published.store(next, std::memory_order_release);
+        TelemetryStream::sample(s);
+        pros::Task::delay_until(&now, period);
+    }
+}
+
+int LouUI::Telemetry::addSource(std::string name, Source read) {
+    start(period);
+    mutex->take(TIMEOUT_MAX);
+    for(const Channel &c : channels){
+        if(c.name == name){
+            mutex->give();
+            throw std::invalid_argument("Channel already exists");
+        }
+    }
+    if(channels.size() == MAX_CHANNELS){
+        mutex->give();
+        throw std::invalid_argument("Too many channels");
+    }
+    channels.push_back({name, std::move(read), false});
+    int channel = (int)channels.size() - 1;
+    mutex->give();
+    return channel;
+}
+
+void LouUI::Telemetry::addMotor(std::string name, pros::Motor motor) {
+    addSource(name + ".temperature", [motor]{
+        return motor.get_temperature();
+    });
+    addSource(name + ".current", [motor]{
+        return (double)motor.get_current_draw();
+    });
+    addSource(name + ".velocity", [motor]{
+        return motor.get_actual_velocity();
+    });
+    addSource(name + ".position", [motor]{
+        return motor.get_position();
+    });
+    addSource(name + ".power", [motor]{
+        return motor.get_power();
+    });
+    addSource(name + ".torque", [motor]{
+        return motor.get_torque();
+    });
+}
+
+int LouUI::Telemetry::getChannel(std::string name) {
+    if(!mutex) throw std::invalid_argument("Invalid channel name");
+    mutex->take(TIMEOUT_MAX);
+    for(size_t i = 0; i < channels.size(); i++){
+        if(channels[i].name == name){
+            mutex->give();
+            return (int)i;
+        }
+    }
+    mutex->give();
+    throw std::invalid_argument("Invalid channel name");
+}
+
+double LouUI::Telemetry::get(int channel) {
+    while(true){
+        uint32_t s = published.load(std::memory_order_acquire);
+        double value = snapshots[s & 1].values[channel];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        //the half that was read is rewritten right after the next publish
+        if(published.load(std::memory_order_relaxed) == s) return value;
+    }
+}
+
+double LouUI::Telemetry::get(std::string name) {
+    return get(getChannel(name));
+}
+
+LouUI::Telemetry::Snapshot LouUI::Telemetry::getSnapshot() {
+    Snapshot copy;
+    while(true){
+        uint32_t s = published.load(std::memory_order_acquire);
+        copy = snapshots[s & 1];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(published.load(std::memory_order_relaxed) == s) return copy;
+    }
+}
+
+void LouUI::Telemetry::addBinding(int channel, Update update,
+                                  bool everySample) {
+    //the lvgl task is walking bindings, so it moves new ones in itself
+    mutex->take(TIMEOUT_MAX);
+    newBindings.push_back({channel, std::move(update), everySample, 0, 0});
+    channels[channel].bound = true;
+    mutex->give();
+    if(!bindingTask){
+        bindingTask = lv_task_create(updateBindings, 40, LV_TASK_PRIO_LOW,
+                                     nullptr);
+    }
+}
+
+void LouUI::Telemetry::updateBindings(void *param) {
+    if(mutex->take(0)){
+        for(Binding &b : newBindings) bindings.push_back(std::move(b));
+        newBindings.clear();
+        mutex->give();
+    }
+    uint32_t s = published.load(std::memory_order_acquire);
+    if(s == 0) return;
+    uint32_t time = snapshots[s & 1].time;
+    for(Binding &b : bindings){
+        double value = get(b.channel);
+        bool changed = b.everySample ? time != b.lastTime : value != b.last;
+        if(!changed && b.lastTime != 0) continue;
+        b.last = value;
+        b.lastTime = time;
+        b.update(value);
+    }
+}
+
+void LouUI::Telemetry::bind(std::string channel, Update update) {
+    addBinding(getChannel(channel), std::move(update), false);
+}
+
+void LouUI::Telemetry::bind(std::string channel, LouUI::Label *label,
+                            std::string format) {
+    addBinding(getChannel(channel), [label, format](double value){
+        char text[64];
+        std::snprintf(text, sizeof(text), format.c_str(), value);
+        label->setText(text);
+    }, false);
+}
+
+void LouUI::Telemetry::bind(std::string channel, LouUI::ControllerView *view,
+                            int row, int column, std::string format,
+                            int width) {
+    if(width <= 0) width = ControllerView::COLUMNS;
+    addBinding(getChannel(channel), [=](double value){
+        char text[ControllerView::COLUMNS + 1];
+        std::snprintf(text, sizeof(text), format.c_str(), value);
+        view->setText(row, column, text, width);
+    }, false);
+}
+
+void LouUI::Telemetry::bind(std::string channel, LouUI::Gauge *gauge) {
+    addBinding(getChannel(channel), [gauge](double value){
+        gauge->setValue((int)value);
+    }, false);
+}
+
+void LouUI::Telemetry::bind(std::string channel, LouUI::Chart *chart,
+                            std::string series) {
+    addBinding(getChannel(channel), [chart, series](double value){
+        chart->addData(series, (int16_t)value);
+    }, true);
+}
@@ -0,0 +1,218 @@
+/**
+ * @file Telemetry.hpp
+ * @brief Shared sampling of motors and sensors for the UI
+ * @details Contains the Telemetry class, which reads every registered device
+ * once per period in one task and lets UI elements read the latest values
+ * without locking.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_TELEMETRY_HPP
+#define LOUUI_TELEMETRY_HPP
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+#include "Chart.hpp"
+#include "ControllerView.hpp"
+#include "Gauge.hpp"
+#include "Label.hpp"
+
+namespace LouUI {
+    /**
+     * @class Telemetry
+     * @brief Reads motors and sensors once per period for every UI element
+     * @details
+     * Each value read by Telemetry is a channel. One background task reads
+     * every channel once per period into the back half of a double-buffered
+     * Snapshot, then publishes it. Readers never lock: get(int channel) and
+     * getSnapshot() copy from the published half and retry in the rare case
+     * that the task published again while they were copying, since the
+     * half they read is rewritten right after that.
+     *
+     * Channels are bound to Labels, Gauges and Charts with bind(). Bindings
+     * are updated from an lvgl task before screen refreshes, so a device is
+     * read once per period no matter how many elements show it.
+     * @subsection usage Usage
+     * @code
+     * LouUI::Telemetry::addMotor("left", pros::Motor(1));
+     * LouUI::Telemetry::bind("left.temperature", tempLabel, "Left: %.0f C");
+     * LouUI::Telemetry::bind("left.velocity", velocityChart, "left");
+     * @endcode
+     */
+    class Telemetry {
+    public:
+
+        /**
+         * Maximum number of channels
+         */
+        static constexpr int MAX_CHANNELS = 64;
+
+        /**
+         * Reads the value of a channel. Called from the telemetry task.
+         */
+        using Source = std::function<double()>;
+
+        /**
+         * Shows a new value of a channel. Called from an lvgl task.
+         */
+        using Update = std::function<void(double)>;
+
+        /**
+         * @struct Snapshot
+         * @brief Values of every channel from one sampling period
+         */
+        struct Snapshot {
+            /**Milliseconds since the program started, when sampled*/
+            uint32_t time;
+            /**Number of valid values*/
+            int count;
+            /**Values, indexed by channel*/
+            double values[MAX_CHANNELS];
+        };
+
+    private:
+        struct Channel {
+            std::string name;
+            Source read;
+            bool bound;
+        };
+
+        struct Binding {
+            int channel;
+            Update update;
+            bool everySample;
+            double last;
+            uint32_t lastTime;
+        };
+
+        static std::vector<Channel> channels;
+        static std::vector<Binding> bindings;
+        static std::vector<Binding> newBindings;
+        static Snapshot snapshots[2];
+        static std::atomic<uint32_t> published;
+        static pros::Mutex *mutex;
+        static pros::Task *task;
+        static lv_task_t *bindingTask;
+        static uint32_t period;
+
+        static void sampleTask(void *param);
+        static void updateBindings(void *param);
+        static void addBinding(int channel, Update update, bool everySample);
+
+    public:
+
+        /**
+         * Starts sampling. Called automatically when the first channel is
+         * added.
+         * @param period milliseconds between samples
+         */
+        static void start(uint32_t period = 20);
+
+        /**
+         * Adds a channel
+         * @param name unique name of the channel
+         * @param read reads the value
+         * @return the index of the channel
+         */
+        static int addSource(std::string name, Source read);
+
+        /**
+         * Adds the channels name.temperature, name.current, name.velocity,
+         * name.position, name.power and name.torque for a motor
+         */
+        static void addMotor(std::string name, pros::Motor motor);
+
+        /**
+         * Gets the index of a channel, which is faster to read than the name
+         */
+        static int getChannel(std::string name);
+
+        /**
+         * Gets the latest value of a channel
+         * @param channel index of the channel
+         */
+        static double get(int channel);
+
+        /**
+         * Gets the latest value of a channel
+         * @param name name of the channel
+         */
+        static double get(std::string name);
+
+        /**
+         * Gets a consistent copy of the latest values of every channel
+         */
+        static Snapshot getSnapshot();
+
+        /**
+         * Runs update with the channel's value whenever the value changes
+         */
+        static void bind(std::string channel, Update update);
+
+        /**
+         * Shows a channel in a label
+         * @param channel name of the channel
+         * @param label label to update
+         * @param format printf format for the value, e.g. "%.1f"
+         */
+        static void bind(std::string channel, Label *label,
+                         std::string format = "%.1f");
+
+        /**
+         * Shows a channel on a line of the controller screen
+         * @param channel name of the channel
+         * @param view controller view to update
+         * @param row line of the controller screen, 0 to 2
+         * @param column first column of the value, 0 to 14
+         * @param format printf format for the value, e.g. "%.1f"
+         * @param width columns the value owns, or 0 for the rest of the line
+         */
+        static void bind(std::string channel, ControllerView *view, int row,
+                         int column, std::string format = "%.1f",
+                         int width = 0);
+
+        /**
+         * Shows a channel on the needle of a gauge
+         */
+        static void bind(std::string channel, Gauge *gauge);
+
+        /**
+         * Adds the newest sample of a channel to a series of a chart each
+         * time the bindings see a new snapshot
+         * @param channel name of the channel
+         * @param chart chart to update
+         * @param series name of the series in the chart
+         */
+        static void bind(std::string channel, Chart *chart,
+                         std::string series);
+    };
+}
+
+
+#endif //LOUUI_TELEMETRY_HPP
@@ -0,0 +1,193 @@
+/**
+ * @file TelemetryStream.cpp
+ * @brief Implementation of TelemetryStream
+ * @details Implements the TelemetryStream class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TelemetryStream.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+std::vector<LouUI::TelemetryStream::Field> LouUI::TelemetryStream::fields;
+LouUI::SampleBuffer<LouUI::TelemetryStream::Frame, 16>
+        LouUI::TelemetryStream::frames;
+//created before any task can add fields
+pros::Mutex *LouUI::TelemetryStream::mutex = new pros::Mutex();
+pros::Task *LouUI::TelemetryStream::writer = nullptr;
+std::atomic<bool> LouUI::TelemetryStream::running{false};
+uint16_t LouUI::TelemetryStream::sequence = 0;
+
+static void put(uint8_t *out, size_t &at, const void *value, size_t size) {
+    //the brain and x86 hosts are both little endian
+    std::memcpy(out + at, value, size);
+    at += size;
+}
+
+void LouUI::TelemetryStream::add(std::string channel,
+                                 LouUI::TelemetryStream::Type type,
+                                 float scale) {
+    int index = Telemetry::getChannel(channel);
+    mutex->take(TIMEOUT_MAX);
+    //a frame only has room for every channel once
+    for(const Field &f : fields){
+        if(f.channel == index){
+            mutex->give();
+            throw std::invalid_argument("Channel is already streamed");
+        }
+    }
+    if(fields.size() == Telemetry::MAX_CHANNELS){
+        mutex->give();
+        throw std::invalid_argument("Too many fields");
+    }
+    fields.push_back({index, type, scale, channel});
+    mutex->give();
+}
+
+void LouUI::TelemetryStream::start() {
+    running = true;
+    if(writer) return;
+    writer = new pros::Task(writeTask, nullptr, TASK_PRIORITY_MIN + 1,
+                            TASK_STACK_DEPTH_DEFAULT, "LouUI stream");
+}
+
+void LouUI::TelemetryStream::stop() {
+    running = false;
+}
+
+void LouUI::TelemetryStream::sample(const Telemetry::Snapshot &snapshot) {
+    if(!running) return;
+    //never wait for add(), the host sees the gap in the sequence
+    if(!mutex->take(0)){
+        sequence++;
+        return;
+    }
+
+    Frame frame;
+    size_t at = 0;
+    frame.data[at++] = 2;
+    put(frame.data, at, &snapshot.time, 4);
+    put(frame.data, at, &sequence, 2);
+    sequence++;
+    for(const Field &f : fields){
+        double value = f.channel < snapshot.count ?
+                       snapshot.values[f.channel] * f.scale : 0;
+        if(f.type == Type::INT16){
+            int16_t v = (int16_t)std::lround(value);
+            put(frame.data, at, &v, 2);
+        }else if(f.type == Type::INT32){
+            int32_t v = (int32_t)std::lround(value);
+            put(frame.data, at, &v, 4);
+        }else{
+            float v = (float)value;
+            put(frame.data, at, &v, 4);
+        }
+    }
+    mutex->give();
+
+    uint16_t crc = crc16(frame.data, at);
+    put(frame.data, at, &crc, 2);
+    frame.length = at;
+    frames.push(frame);
+}
+
+void LouUI::TelemetryStream::write(const uint8_t *frame, size_t length) {
+    //only grows while the schema grows
+    static std::vector<uint8_t> out;
+    out.resize(std::max(out.size(), length + length / 254 + 2));
+    out[0] = 0;
+    size_t size = cobs(frame, length, out.data() + 1) + 1;
+    std::fwrite(out.data(), 1, size, stdout);
+}
+
+void LouUI::TelemetryStream::writeTask(void *param) {
+    uint32_t lastSchema = 0;
+    bool schemaSent = false;
+    Frame frame;
+    while(true){
+        bool wrote = false;
+        if(running && (!schemaSent || pros::millis() - lastSchema >= 2000)){
+            std::vector<uint8_t> schema = {1};
+            mutex->take(TIMEOUT_MAX);
+            schema.push_back((uint8_t)fields.size());
+            for(const Field &f : fields){
+                uint8_t scale[4];
+                std::memcpy(scale, &f.scale, 4);
+                schema.push_back((uint8_t)f.type);
+                schema.insert(schema.end(), scale, scale + 4);
+                schema.push_back((uint8_t)f.name.size());
+                schema.insert(schema.end(), f.name.begin(), f.name.end());
+            }
+            mutex->give();
+            uint16_t crc = crc16(schema.data(), schema.size());
+            schema.push_back(crc & 0xFF);
+            schema.push_back(crc >> 8);
+            write(schema.data(), schema.size());
+            lastSchema = pros::millis();
+            schemaSent = true;
+            wrote = true;
+        }
+
+        while(frames.pop(frame)){
+            write(frame.data, frame.length);
+            wrote = true;
+        }
+        if(wrote) std::fflush(stdout);
+        pros::delay(20);
+    }
+}
+
+uint32_t LouUI::TelemetryStream::getDropped() {
+    return frames.getDropped();
+}
+
+uint16_t LouUI::TelemetryStream::crc16(const uint8_t *data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for(size_t i = 0; i < length; i++){
+        crc ^= (uint16_t)data[i] << 8;
+        for(int bit = 0; bit < 8; bit++){
+            crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+size_t LouUI::TelemetryStream::cobs(const uint8_t *data, size_t length,
+                                    uint8_t *out) {
+    size_t code = 0, at = 1;
+    uint8_t run = 1;
+    for(size_t i = 0; i < length; i++){
+        if(data[i] != 0) out[at++] = data[i];
+        if(data[i] == 0 || ++run == 0xFF){
+            out[code] = data[i] == 0 ? run : 0xFF;
+            code = at++;
+            run = 1;
+        }
+    }
+    out[code] = run;
+    return at;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file TelemetryStream.hpp
+ * @brief TelemetryStream class
+ * @details Header file for the TelemetryStream class, which streams telemetry
+ * channels over the USB serial link as binary frames
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_TELEMETRYSTREAM_HPP
+#define LOUUI_TELEMETRYSTREAM_HPP
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "../../include/api.h"
+#include "SampleBuffer.hpp"
+#include "Telemetry.hpp"
+
+namespace LouUI {
+    /**
+     * @class TelemetryStream
+     * @brief Streams Telemetry channels to a computer over USB
+     * @details
+     * Instead of printf, the chosen channels are packed into binary frames
+     * each time the Telemetry task samples them. Packing only copies
+     * numbers into a preallocated frame, which is pushed into a
+     * SampleBuffer without blocking; when the buffer is full the frame is
+     * dropped and counted. A low priority task encodes the frames with
+     * COBS and writes them to stdout, each one preceded by a 0x00
+     * delimiter so printed text next to the frames can't corrupt them.
+     *
+     * Frames before COBS, little endian, end with a CRC-16-CCITT of the
+     * bytes before it:
+     * - schema, sent at start and every 2 s: 1, the number of fields, then
+     *   for each field its type, its scale as a float and its name (length
+     *   then characters)
+     * - samples: 2, the time in milliseconds (32 bits), a sequence number
+     *   (16 bits), then every field in its type, multiplied by its scale
+     *
+     * tools/telemetry.py decodes the stream on the computer.
+     * @subsection usage Usage
+     * @code
+     * LouUI::Telemetry::addMotor("left", pros::Motor(1));
+     * LouUI::TelemetryStream::add("left.velocity");
+     * LouUI::TelemetryStream::add("left.temperature",
+     *                             LouUI::TelemetryStream::Type::INT16);
+     * LouUI::TelemetryStream::start();
+     * @endcode
+     */
+    class TelemetryStream {
+    public:
+
+        /**
+         * @enum Type
+         * @brief How a field is sent
+         */
+        enum class Type : uint8_t {
+            INT16 = 1,
+            INT32 = 2,
+            FLOAT = 3
+        };
+
+        /**Largest samples frame, before COBS*/
+        static constexpr int MAX_FRAME = 7 + Telemetry::MAX_CHANNELS * 4 + 2;
+
+    private:
+        struct Field {
+            int channel;
+            Type type;
+            float scale;
+            std::string name;
+        };
+
+        struct Frame {
+            uint16_t length;
+            uint8_t data[MAX_FRAME];
+        };
+
+        static std::vector<Field> fields;
+        static SampleBuffer<Frame, 16> frames;
+        static pros::Mutex *mutex;
+        static pros::Task *writer;
+        static std::atomic<bool> running;
+        static uint16_t sequence;
+
+        static void writeTask(void *param);
+        static void write(const uint8_t *frame, size_t length);
+
+    public:
+
+        /**
+         * Adds a channel to the stream
+         *
+         * @param channel The name of the Telemetry channel
+         * @param type How the value is sent
+         * @param scale Multiplies the value before it is sent, e.g. 100 to
+         * keep two decimals in an INT16
+         * @throws std::invalid_argument if the channel is already streamed
+         */
+        static void add(std::string channel, Type type = Type::FLOAT,
+                        float scale = 1);
+
+        /**
+         * Starts streaming
+         */
+        static void start();
+
+        /**
+         * Stops streaming
+         */
+        static void stop();
+
+        /**
+         * Packs a snapshot into a frame. Called from the Telemetry task
+         */
+        static void sample(const Telemetry::Snapshot &snapshot);
+
+        /**
+         * Gets the number of frames dropped because the writer fell behind
+         */
+        static uint32_t getDropped();
+
+        /**
+         * Computes the CRC-16-CCITT (0x1021, starting at 0xFFFF) of bytes
+         */
+        static uint16_t crc16(const uint8_t *data, size_t length);
+
+        /**
+         * COBS encodes bytes, without the 0x00 delimiter
+         *
+         * @param out Needs room for length + length / 254 + 1 bytes
+         * @return The number of bytes written to out
+         */
+        static size_t cobs(const uint8_t *data, size_t length, uint8_t *out);
+    };
+}
+
+
+#endif //LOUUI_TELEMETRYSTREAM_HPP
@@ -29,6 +29,8 @@
  */
 
 #include "ToggleButton.hpp"
+#include "Memory.hpp"
+#include "TouchInput.hpp"
 #include "../../include/display/lv_objx/lv_btn.h"
 #include <vector>
 
@@ -43,17 +45,23 @@ lv_btn_state_t LouUI::ToggleButton::convertState(LouUI::ToggleButton::State s) {
 
 LouUI::ToggleButton::ToggleButton(lv_obj_t *parent) {
     obj = lv_btn_create(parent, nullptr);
+    lv_obj_set_free_ptr(obj, this);
     lv_btn_set_toggle(obj, true);
 
-    releasedStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    releasedStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                 "ToggleButton", obj));
     lv_style_copy(releasedStyle, &lv_style_btn_rel);
-    pressedStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    pressedStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                "ToggleButton", obj));
     lv_style_copy(pressedStyle, &lv_style_btn_pr);
-    toggledReleasedStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    toggledReleasedStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                        "ToggleButton", obj));
     lv_style_copy(toggledReleasedStyle, &lv_style_btn_tgl_rel);
-    toggledPressedStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    toggledPressedStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                       "ToggleButton", obj));
     lv_style_copy(toggledPressedStyle, &lv_style_btn_tgl_pr);
-    inactiveStyle = (lv_style_t *)(malloc(sizeof(lv_style_t)));
+    inactiveStyle = (lv_style_t *)(Memory::alloc(sizeof(lv_style_t),
+                                                 "ToggleButton", obj));
     lv_style_copy(inactiveStyle, &lv_style_btn_ina);
 
     lv_btn_set_style(obj, LV_BTN_STYLE_REL, releasedStyle);
@@ -65,6 +73,9 @@ LouUI::ToggleButton::ToggleButton(lv_obj_t *parent) {
 
 LouUI::ToggleButton::ToggleButton(lv_obj_t *parent, LouUI::ToggleButton b) {
     obj = lv_btn_create(parent, b.getObj());
+    lv_obj_set_free_ptr(obj, this);
+    //lvgl copies the click action, which may be dispatch
+    callback = b.callback;
 
     releasedStyle = lv_btn_get_style(obj, LV_BTN_STYLE_REL);
     pressedStyle = lv_btn_get_style(obj, LV_BTN_STYLE_PR);
@@ -73,6 +84,11 @@ LouUI::ToggleButton::ToggleButton(lv_obj_t *parent, LouUI::ToggleButton b) {
     inactiveStyle = lv_btn_get_style(obj, LV_BTN_STYLE_INA);
 }
 
+lv_res_t LouUI::ToggleButton::dispatch(lv_obj_t *btn) {
+    auto *b = (ToggleButton *)lv_obj_get_free_ptr(btn);
+    return b ? b->callback() : (lv_res_t)LV_RES_OK;
+}
+
 lv_obj_t *LouUI::ToggleButton::getObj() const {
     return obj;
 }
@@ -729,3 +745,12 @@ LouUI::ToggleButton::setAction(LouUI::ToggleButton::Action a) {
     return this;
 }
 
+LouUI::ToggleButton *
+LouUI::ToggleButton::setFastAction(LouUI::ToggleButton::Action a) {
+    //TouchInput toggles the button, lvgl only shows the pressed state
+    lv_btn_set_toggle(obj, false);
+    lv_btn_set_action(obj, LV_BTN_ACTION_CLICK, nullptr);
+    TouchInput::addHandler(obj, nullptr, a, true);
+    return this;
+}
+
@@ -35,6 +35,9 @@
 #include "../../include/display/lv_core/lv_obj.h"
 #include "Color.hpp"
 #include "Align.hpp"
+#include "InlineAction.hpp"
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace LouUI {
@@ -64,8 +67,12 @@ namespace LouUI {
         lv_style_t *toggledPressedStyle;
         lv_style_t *inactiveStyle;
 
+        InlineAction callback;
+
         lv_btn_state_t convertState(State s);
 
+        static lv_res_t dispatch(lv_obj_t *btn);
+
     public:
 
         /**
@@ -127,6 +134,44 @@ namespace LouUI {
          */
         ToggleButton* setAction(Action a);
 
+        /**
+         * Sets an action to execute as soon as the button is released,
+         * without waiting for lvgl's next input read. Replaces any action set
+         * with setAction(Action a). The button is toggled as soon as it is
+         * released, before the action runs.
+         * @param a The function to be executed, with the same requirements
+         * as setAction(Action a)
+         * @see TouchInput
+         */
+        ToggleButton* setFastAction(Action a);
+
+        /**
+         * Sets a callable, such as a lambda with captures, to execute when
+         * the button is clicked. The callable is stored inside the button
+         * without heap allocation, so its captures must fit in
+         * InlineAction::SIZE bytes.
+         * @param f The callable to be executed. It takes no parameters and
+         * may return lv_res_t.
+         */
+        template <typename F, typename = typename std::enable_if<
+                !std::is_convertible<F, Action>::value>::type>
+        ToggleButton* setAction(F &&f) {
+            callback = InlineAction(std::forward<F>(f));
+            return setAction(dispatch);
+        }
+
+        /**
+         * Sets a callable to execute as soon as the button is released, with
+         * the same requirements as setAction(F &&f)
+         * @see setFastAction(Action a)
+         */
+        template <typename F, typename = typename std::enable_if<
+                !std::is_convertible<F, Action>::value>::type>
+        ToggleButton* setFastAction(F &&f) {
+            callback = InlineAction(std::forward<F>(f));
+            return setFastAction(dispatch);
+        }
+
         /**
          * Sets the width of the button
          */
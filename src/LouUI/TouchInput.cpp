@@ -0,0 +1,192 @@
+/**
+ * @file TouchInput.cpp
+ * @brief Low latency touch input
+ * @details Implementation file for the TouchInput class, which delivers screen
+ * presses and releases to LouUI handlers as soon as PROS reports them instead
+ * of waiting for the next lvgl input read
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TouchInput.hpp"
+#include <algorithm>
+#include <cstring>
+#include "../../include/display/lv_objx/lv_btn.h"
+#include "Governor.hpp"
+
+std::vector<LouUI::TouchInput::Handler> LouUI::TouchInput::handlers;
+std::vector<LouUI::TouchInput::Event> LouUI::TouchInput::events;
+//created before any task can add a handler
+pros::Mutex *LouUI::TouchInput::mutex = new pros::Mutex();
+pros::Task *LouUI::TouchInput::task = nullptr;
+lv_task_t *LouUI::TouchInput::dispatchTask = nullptr;
+int LouUI::TouchInput::activePeriod = 5;
+int32_t LouUI::TouchInput::pressCount = 0;
+int32_t LouUI::TouchInput::releaseCount = 0;
+lv_obj_t *LouUI::TouchInput::pressedObj = nullptr;
+
+void LouUI::TouchInput::enable(int activePeriod) {
+    TouchInput::activePeriod = std::max(activePeriod, 1);
+    if(task){
+        lv_task_set_period(dispatchTask, TouchInput::activePeriod);
+        return;
+    }
+
+    events.reserve(MAX_EVENTS);
+    pros::screen_touch_status_s_t s = pros::screen::touch_status();
+    pressCount = s.press_count;
+    releaseCount = s.release_count;
+
+    dispatchTask = lv_task_create(dispatch, TouchInput::activePeriod,
+                                  LV_TASK_PRIO_HIGH, nullptr);
+    task = new pros::Task(pollTask, nullptr, TASK_PRIORITY_DEFAULT + 1,
+                          TASK_STACK_DEPTH_DEFAULT, "LouUI touch");
+    pros::screen::touch_callback(touchCallback, pros::E_TOUCH_PRESSED);
+    pros::screen::touch_callback(touchCallback, pros::E_TOUCH_RELEASED);
+}
+
+void LouUI::TouchInput::addHandler(lv_obj_t *obj, Action onPress,
+                                   Action onRelease, bool toggle) {
+    enable(activePeriod);
+    mutex->take(TIMEOUT_MAX);
+    handlers.erase(std::remove_if(handlers.begin(), handlers.end(),
+                                  [obj](const Handler &h){
+                                      return h.obj == obj;
+                                  }), handlers.end());
+    handlers.push_back({obj, onPress, onRelease, toggle});
+    mutex->give();
+}
+
+void LouUI::TouchInput::removeHandler(lv_obj_t *obj) {
+    mutex->take(TIMEOUT_MAX);
+    handlers.erase(std::remove_if(handlers.begin(), handlers.end(),
+                                  [obj](const Handler &h){
+                                      return h.obj == obj;
+                                  }), handlers.end());
+    if(pressedObj == obj) pressedObj = nullptr;
+    mutex->give();
+}
+
+void LouUI::TouchInput::touchCallback(int16_t x, int16_t y) {
+    //a press wakes the poll task, which also records the event
+    if(task) task->notify();
+}
+
+void LouUI::TouchInput::pollTask(void *param) {
+    while(true){
+        pros::Task::notify_take(true, TIMEOUT_MAX);
+        //poll quickly only while the screen is held
+        while(update()){
+            pros::delay(activePeriod);
+        }
+    }
+}
+
+bool LouUI::TouchInput::update() {
+    bool recorded = false;
+
+    mutex->take(TIMEOUT_MAX);
+    pros::screen_touch_status_s_t s = pros::screen::touch_status();
+
+    //counters make each press and release run exactly once
+    if(s.press_count != pressCount){
+        pressCount = s.press_count;
+        if(events.size() < MAX_EVENTS){
+            events.push_back({true, s.x, s.y});
+            recorded = true;
+        }
+    }
+
+    if(s.release_count != releaseCount){
+        releaseCount = s.release_count;
+        if(events.size() < MAX_EVENTS){
+            events.push_back({false, s.x, s.y});
+            recorded = true;
+        }
+    }
+    mutex->give();
+
+    //lets the lvgl task run even if the governor waits for a change
+    if(recorded) Governor::markDirty();
+
+    return s.touch_status != pros::E_TOUCH_RELEASED;
+}
+
+void LouUI::TouchInput::dispatch(void *param) {
+    Action actions[MAX_EVENTS];
+    lv_obj_t *targets[MAX_EVENTS];
+    int count = 0;
+
+    //the touch task only holds the lock briefly, so this waits a period
+    //instead of blocking lvgl
+    if(!mutex->take(0)) return;
+    for(const Event &e : events){
+        if(e.press){
+            pressedObj = nullptr;
+            //last added handler is the one drawn on top
+            for(auto h = handlers.rbegin(); h != handlers.rend(); h++){
+                if(!hit(h->obj, e.x, e.y)) continue;
+                pressedObj = h->obj;
+                if(h->onPress){
+                    actions[count] = h->onPress;
+                    targets[count++] = h->obj;
+                }
+                break;
+            }
+        }else{
+            for(auto &h: handlers){
+                if(h.obj != pressedObj || !hit(h.obj, e.x, e.y)) continue;
+                if(h.toggle) lv_btn_toggle(h.obj);
+                if(h.onRelease){
+                    actions[count] = h.onRelease;
+                    targets[count++] = h.obj;
+                }
+                break;
+            }
+            pressedObj = nullptr;
+        }
+    }
+    events.clear();
+    mutex->give();
+
+    //actions run unlocked so they can add or remove handlers
+    for(int i = 0; i < count; i++) actions[i](targets[i]);
+}
+bool LouUI::TouchInput::hit(lv_obj_t *obj, lv_coord_t x, lv_coord_t y) {
+    if(lv_obj_get_screen(obj) != lv_scr_act()) return false;
+    lv_obj_type_t type;
+    lv_obj_get_type(obj, &type);
+    if(std::strcmp(type.type[0], "lv_btn") == 0 &&
+       lv_btn_get_state(obj) == LV_BTN_STATE_INA){
+        return false;
+    }
+
+    //the point must be inside the object and every parent clipping it
+    for(lv_obj_t *o = obj; o; o = lv_obj_get_parent(o)){
+        if(lv_obj_get_hidden(o)) return false;
+        lv_area_t a;
+        lv_obj_get_coords(o, &a);
+        if(x < a.x1 || x > a.x2 || y < a.y1 || y > a.y2) return false;
+    }
+    return true;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file TouchInput.hpp
+ * @brief Low latency touch input
+ * @details Header file for the TouchInput class, which delivers screen presses
+ * and releases to LouUI handlers as soon as PROS reports them instead of
+ * waiting for the next lvgl input read
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_TOUCHINPUT_HPP
+#define LOUUI_TOUCHINPUT_HPP
+
+#include <vector>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+
+namespace LouUI {
+    /**
+     * @class TouchInput
+     * @brief Low latency press and release handlers
+     * @details
+     * lvgl reads the touch screen every LV_INDEV_READ_PERIOD (50 ms), so a
+     * tap can take up to two periods to reach a button action. TouchInput
+     * hooks the PROS touch callbacks instead, and while the screen is held
+     * it polls the touch status every few milliseconds so the release is
+     * seen right away. When nothing is pressed its task sleeps, so it adds
+     * no idle CPU use.
+     *
+     * Every physical press and release is delivered once: the PROS press
+     * and release counters are used to drop events that both the callback
+     * and the poll saw.
+     *
+     * The TouchInput task only records the presses and releases. Since lvgl
+     * is not thread safe, an lvgl task finds the touched object, toggles it
+     * and runs the handlers, so handlers run in the lvgl task like regular
+     * button actions.
+     *
+     * Buttons use this through Button::setFastAction(Action a) and
+     * ToggleButton::setFastAction(Action a).
+     */
+    class TouchInput {
+    public:
+
+        using Action = lv_action_t;
+
+    private:
+        struct Handler {
+            lv_obj_t *obj;
+            Action onPress;
+            Action onRelease;
+            bool toggle;
+        };
+
+        struct Event {
+            bool press;
+            lv_coord_t x;
+            lv_coord_t y;
+        };
+
+        /**Most events kept between two runs of the lvgl task*/
+        static constexpr size_t MAX_EVENTS = 16;
+
+        static std::vector<Handler> handlers;
+        static std::vector<Event> events;
+        static pros::Mutex *mutex;
+        static pros::Task *task;
+        static lv_task_t *dispatchTask;
+        static int activePeriod;
+
+        static int32_t pressCount;
+        static int32_t releaseCount;
+        static lv_obj_t *pressedObj;
+
+        static void touchCallback(int16_t x, int16_t y);
+        static void pollTask(void *param);
+        static bool update();
+        static void dispatch(void *param);
+        static bool hit(lv_obj_t *obj, lv_coord_t x, lv_coord_t y);
+
+    public:
+
+        /**
+         * Starts listening for touches. Called automatically when the first
+         * handler is added.
+         * @param activePeriod milliseconds between touch reads while the
+         * screen is held, and between runs of the lvgl task that delivers
+         * them
+         */
+        static void enable(int activePeriod = 5);
+
+        /**
+         * Adds handlers for an object. Handlers only run when the touch is
+         * inside the object and the object is on the active screen.
+         * @param obj object that is touched
+         * @param onPress action run when the object is pressed, or nullptr
+         * @param onRelease action run when a press that started on the
+         * object is released on it, or nullptr
+         * @param toggle whether to toggle the button before onRelease runs
+         */
+        static void addHandler(lv_obj_t *obj, Action onPress,
+                               Action onRelease, bool toggle = false);
+
+        /**
+         * Removes the handlers of an object
+         */
+        static void removeHandler(lv_obj_t *obj);
+    };
+}
+
+
+#endif //LOUUI_TOUCHINPUT_HPP
@@ -0,0 +1,223 @@
+/**
+ * @file TransitionCache.cpp
+ * @brief Implementation of TransitionCache
+ * @details Implements the TransitionCache class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TransitionCache.hpp"
+#include "Memory.hpp"
+#include "Pixels.hpp"
+#include "../../include/display/lv_core/lv_refr.h"
+#include "../../include/display/lv_core/lv_vdb.h"
+#include "../../include/display/lv_objx/lv_img.h"
+#include "../../include/display/lv_objx/lv_page.h"
+#include <algorithm>
+
+std::vector<LouUI::TransitionCache::Snapshot>
+        LouUI::TransitionCache::snapshots;
+lv_obj_t *LouUI::TransitionCache::tabView = nullptr;
+lv_tabview_action_t LouUI::TransitionCache::userAction = nullptr;
+lv_disp_t *LouUI::TransitionCache::captureDisp = nullptr;
+LouUI::TransitionCache::Snapshot *LouUI::TransitionCache::target = nullptr;
+lv_area_t LouUI::TransitionCache::targetArea;
+lv_area_t LouUI::TransitionCache::spill;
+lv_task_t *LouUI::TransitionCache::endTask = nullptr;
+
+void LouUI::TransitionCache::copy(int32_t x1, int32_t y1, int32_t x2,
+                                  int32_t y2, const lv_color_t *pixels,
+                                  bool fill) {
+    if(!target) return;
+    //parts outside the snapshot were meant for the display
+    if(x1 < targetArea.x1 || y1 < targetArea.y1 || x2 > targetArea.x2 ||
+       y2 > targetArea.y2){
+        spill.x1 = std::min<lv_coord_t>(spill.x1, x1);
+        spill.y1 = std::min<lv_coord_t>(spill.y1, y1);
+        spill.x2 = std::max<lv_coord_t>(spill.x2, x2);
+        spill.y2 = std::max<lv_coord_t>(spill.y2, y2);
+    }
+    int32_t width = targetArea.x2 - targetArea.x1 + 1;
+    int32_t left = std::max<int32_t>(x1, targetArea.x1);
+    int32_t right = std::min<int32_t>(x2, targetArea.x2);
+    int32_t top = std::max<int32_t>(y1, targetArea.y1);
+    int32_t bottom = std::min<int32_t>(y2, targetArea.y2);
+    if(right < left) return;
+    for(int32_t y = top; y <= bottom; y++){
+        lv_color_t *dst = target->pixels + (y - targetArea.y1) * width +
+                          (left - targetArea.x1);
+        if(fill){
+            Pixels::fill(dst, right - left + 1, *pixels);
+        }else{
+            const lv_color_t *src = pixels + (y - y1) * (x2 - x1 + 1) +
+                                    (left - x1);
+            std::copy(src, src + (right - left + 1), dst);
+        }
+    }
+}
+
+void LouUI::TransitionCache::captureFlush(int32_t x1, int32_t y1, int32_t x2,
+                                          int32_t y2,
+                                          const lv_color_t *pixels) {
+    copy(x1, y1, x2, y2, pixels, false);
+    lv_flush_ready();
+}
+
+void LouUI::TransitionCache::captureFill(int32_t x1, int32_t y1, int32_t x2,
+                                         int32_t y2, lv_color_t color) {
+    copy(x1, y1, x2, y2, &color, true);
+}
+
+void LouUI::TransitionCache::captureMap(int32_t x1, int32_t y1, int32_t x2,
+                                        int32_t y2,
+                                        const lv_color_t *pixels) {
+    copy(x1, y1, x2, y2, pixels, false);
+}
+
+LouUI::TransitionCache::Snapshot &
+LouUI::TransitionCache::getSnapshot(lv_obj_t *page) {
+    for(Snapshot &s : snapshots){
+        if(s.page == page) return s;
+    }
+    snapshots.push_back({page, nullptr, {}, nullptr});
+    return snapshots.back();
+}
+
+void LouUI::TransitionCache::capture(LouUI::TransitionCache::Snapshot &s) {
+    lv_area_t a;
+    lv_obj_get_coords(s.page, &a);
+    a.x1 = std::max<lv_coord_t>(a.x1, 0);
+    a.y1 = std::max<lv_coord_t>(a.y1, 0);
+    a.x2 = std::min<lv_coord_t>(a.x2, LV_HOR_RES - 1);
+    a.y2 = std::min<lv_coord_t>(a.y2, LV_VER_RES - 1);
+    if(a.x2 < a.x1 || a.y2 < a.y1) return;
+    uint32_t w = a.x2 - a.x1 + 1;
+    uint32_t h = a.y2 - a.y1 + 1;
+
+    if(!s.pixels || s.dsc.header.w != w || s.dsc.header.h != h){
+        Memory::free(s.pixels);
+        s.pixels = (lv_color_t *)(Memory::alloc(sizeof(lv_color_t) * w * h,
+                                                "TransitionCache", s.page));
+        s.dsc.header.cf = LV_IMG_CF_TRUE_COLOR;
+        s.dsc.header.always_zero = 0;
+        s.dsc.header.w = w;
+        s.dsc.header.h = h;
+        s.dsc.data_size = sizeof(lv_color_t) * w * h;
+        s.dsc.data = (const uint8_t *)s.pixels;
+    }
+
+    //areas already waiting are drawn to the display first, so the
+    //capture only renders the page and the display needs no redraw
+    lv_refr_now();
+
+    //render the page into the snapshot instead of the display
+    target = &s;
+    targetArea = a;
+    spill = {LV_HOR_RES, LV_VER_RES, -1, -1};
+    lv_disp_t *display = lv_disp_get_active();
+    lv_disp_set_active(captureDisp);
+    lv_inv_area(&a);
+    lv_refr_now();
+    lv_disp_set_active(display);
+    target = nullptr;
+
+    if(spill.x2 >= spill.x1) lv_inv_area(&spill);
+}
+
+void LouUI::TransitionCache::show(LouUI::TransitionCache::Snapshot &s) {
+    if(!s.pixels) return;
+    //the image covers the page, so lvgl skips the elements under it
+    lv_obj_t *scrl = lv_page_get_scrl(s.page);
+    s.img = lv_img_create(s.page, nullptr);
+    lv_img_set_src(s.img, &s.dsc);
+    lv_obj_set_pos(s.img, -lv_obj_get_x(scrl), -lv_obj_get_y(scrl));
+}
+
+void LouUI::TransitionCache::endTransition(void *param) {
+    endTask = nullptr;
+    for(Snapshot &s : snapshots){
+        if(s.img){
+            lv_obj_del(s.img);
+            s.img = nullptr;
+        }
+    }
+}
+
+lv_res_t LouUI::TransitionCache::tabLoad(lv_obj_t *tabView, uint16_t id) {
+    if(userAction){
+        lv_res_t res = userAction(tabView, id);
+        if(res != LV_RES_OK) return res;
+    }
+    if(lv_tabview_get_anim_time(tabView) == 0) return LV_RES_OK;
+
+    if(endTask){
+        lv_task_del(endTask);
+        endTransition(nullptr);
+    }
+
+    lv_obj_t *from = lv_tabview_get_tab(tabView,
+                                        lv_tabview_get_tab_act(tabView));
+    lv_obj_t *to = lv_tabview_get_tab(tabView, id);
+    getSnapshot(from);
+    getSnapshot(to);
+    capture(getSnapshot(from));
+    show(getSnapshot(from));
+    show(getSnapshot(to));
+
+    endTask = lv_task_create(endTransition,
+                             lv_tabview_get_anim_time(tabView) + 50,
+                             LV_TASK_PRIO_LOW, nullptr);
+    lv_task_once(endTask);
+    return LV_RES_OK;
+}
+
+void LouUI::TransitionCache::enable(lv_obj_t *tabView) {
+    if(!captureDisp){
+        lv_disp_drv_t driver;
+        lv_disp_drv_init(&driver);
+        driver.disp_flush = captureFlush;
+        driver.disp_fill = captureFill;
+        driver.disp_map = captureMap;
+        lv_disp_t *display = lv_disp_get_active();
+        captureDisp = lv_disp_drv_register(&driver);
+        lv_disp_set_active(display);
+    }
+
+    TransitionCache::tabView = tabView;
+    lv_tabview_action_t action = lv_tabview_get_tab_load_action(tabView);
+    if(action != tabLoad) userAction = action;
+    lv_tabview_set_tab_load_action(tabView, tabLoad);
+}
+
+void LouUI::TransitionCache::disable() {
+    if(!tabView) return;
+    lv_tabview_set_tab_load_action(tabView, userAction);
+    if(endTask){
+        lv_task_del(endTask);
+        endTransition(nullptr);
+    }
+    for(Snapshot &s : snapshots) Memory::free(s.pixels);
+    snapshots.clear();
+    tabView = nullptr;
+    userAction = nullptr;
+}
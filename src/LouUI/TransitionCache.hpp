@@ -0,0 +1,105 @@
+/**
+ * @file TransitionCache.hpp
+ * @brief Cached screens for tab transitions
+ * @details Contains the TransitionCache class, which slides snapshots of the
+ * screens instead of their live elements when the Display switches tabs.
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_TRANSITIONCACHE_HPP
+#define LOUUI_TRANSITIONCACHE_HPP
+
+#include <vector>
+
+#include "../../include/display/lvgl.h"
+#include "../../include/display/lv_objx/lv_tabview.h"
+
+namespace LouUI {
+    /**
+     * @class TransitionCache
+     * @brief Slides snapshots of the screens when tabs are switched
+     * @details
+     * Without the cache, every frame of the tab sliding animation redraws
+     * every element of both screens. With it, a screen is rendered once
+     * into a snapshot when it is left, while it is still settled on the
+     * screen. During a transition the snapshots of both screens are shown
+     * on top of their live elements, so lvgl only draws the two images.
+     * When the animation ends the snapshots are removed and the live
+     * elements take over again.
+     *
+     * A screen that has not been left yet has no snapshot and slides in
+     * live. Each snapshot takes 4 bytes per pixel of the screen.
+     *
+     * Usually used through Display::setTransitionCache(bool enabled).
+     */
+    class TransitionCache {
+    private:
+        struct Snapshot {
+            lv_obj_t *page;
+            lv_color_t *pixels;
+            lv_img_dsc_t dsc;
+            lv_obj_t *img;
+        };
+
+        static std::vector<Snapshot> snapshots;
+        static lv_obj_t *tabView;
+        static lv_tabview_action_t userAction;
+        static lv_disp_t *captureDisp;
+        static Snapshot *target;
+        static lv_area_t targetArea;
+        static lv_area_t spill;
+        static lv_task_t *endTask;
+
+        static void copy(int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+                         const lv_color_t *pixels, bool fill);
+        static void captureFlush(int32_t x1, int32_t y1, int32_t x2,
+                                 int32_t y2, const lv_color_t *pixels);
+        static void captureFill(int32_t x1, int32_t y1, int32_t x2,
+                                int32_t y2, lv_color_t color);
+        static void captureMap(int32_t x1, int32_t y1, int32_t x2,
+                               int32_t y2, const lv_color_t *pixels);
+
+        static Snapshot &getSnapshot(lv_obj_t *page);
+        static void capture(Snapshot &s);
+        static void show(Snapshot &s);
+        static lv_res_t tabLoad(lv_obj_t *tabView, uint16_t id);
+        static void endTransition(void *param);
+
+    public:
+
+        /**
+         * Starts caching the screens of a tab view. Any tab load action
+         * already set on the tab view is still called.
+         */
+        static void enable(lv_obj_t *tabView);
+
+        /**
+         * Stops caching and frees the snapshots
+         */
+        static void disable();
+    };
+}
+
+
+#endif //LOUUI_TRANSITIONCACHE_HPP
@@ -0,0 +1,360 @@
+/**
+ * @file XYPlot.cpp
+ * @brief Implementation of XYPlot
+ * @details Implements the XYPlot class
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "XYPlot.hpp"
+#include "Memory.hpp"
+#include "Pixels.hpp"
+#include "../../include/display/lv_core/lv_refr.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    //pushed in place of a point to clear a series in order with its points
+    constexpr int32_t CLEAR = INT32_MIN;
+
+    //pixels further outside than this are clipped anyway
+    constexpr int64_t PIXEL_LIMIT = 1 << 20;
+
+    int32_t toFixed(double value) {
+        double fixed = std::round(value * 65536.0);
+        if(!(fixed > INT32_MIN)) return INT32_MIN + 1;
+        if(fixed > INT32_MAX) return INT32_MAX;
+        return (int32_t)fixed;
+    }
+
+    int64_t toScale(int pixels, double range) {
+        //pixels per fixed point unit, in 32.32 fixed point
+        double scale = std::round(pixels / range * 65536.0);
+        return (int64_t)std::min(scale, (double)INT32_MAX);
+    }
+
+    bool clip(double &x0, double &y0, double &x1, double &y1, int width,
+              int height) {
+        //Liang-Barsky against the canvas, so off screen segments cost
+        //nothing to draw
+        double t0 = 0;
+        double t1 = 1;
+        double dx = x1 - x0;
+        double dy = y1 - y0;
+        double p[4] = {-dx, dx, -dy, dy};
+        double q[4] = {x0, width - 1 - x0, y0, height - 1 - y0};
+        for(int i = 0; i < 4; i++){
+            if(p[i] == 0){
+                if(q[i] < 0) return false;
+                continue;
+            }
+            double t = q[i] / p[i];
+            if(p[i] < 0){
+                if(t > t1) return false;
+                t0 = std::max(t0, t);
+            } else{
+                if(t < t0) return false;
+                t1 = std::min(t1, t);
+            }
+        }
+        double startX = x0;
+        double startY = y0;
+        x0 = startX + t0 * dx;
+        y0 = startY + t0 * dy;
+        x1 = startX + t1 * dx;
+        y1 = startY + t1 * dy;
+        return true;
+    }
+}
+
+LouUI::XYPlot::XYPlot(lv_obj_t *parent, int width, int height)
+        : width(width), height(height) {
+    if(width < 2 || height < 2){
+        throw std::invalid_argument("XYPlot is too small");
+    }
+    obj = lv_canvas_create(parent, nullptr);
+    buffer = (lv_color_t *)(Memory::alloc(sizeof(lv_color_t) * width *
+                                          height, "XYPlot", obj));
+    lv_canvas_set_buffer(obj, buffer, width, height, LV_IMG_CF_TRUE_COLOR);
+    background = Color(20, 20, 20).toLvColor();
+    axes = Color(70, 70, 70).toLvColor();
+    project(viewport);
+    drawAll();
+    updater = lv_task_create(update, 40, LV_TASK_PRIO_MID, this);
+}
+
+LouUI::XYPlot::~XYPlot() {
+    //the canvas draws from the buffer, so it goes first
+    lv_task_del(updater);
+    lv_obj_del(obj);
+    Memory::free(buffer);
+    for(int i = 0; i < seriesCount.load(); i++){
+        Memory::free(series[i].x);
+        Memory::free(series[i].y);
+    }
+}
+
+void LouUI::XYPlot::project(const Viewport &v) {
+    originX = toFixed(v.xMin);
+    originY = toFixed(v.yMin);
+    scaleX = toScale(width - 1, v.xMax - v.xMin);
+    scaleY = toScale(height - 1, v.yMax - v.yMin);
+    //larger distances from the origin are past PIXEL_LIMIT anyway, and
+    //clamping them keeps the product in 64 bits
+    maxDeltaX = (PIXEL_LIMIT << 32) / std::max<int64_t>(scaleX, 1);
+    maxDeltaY = (PIXEL_LIMIT << 32) / std::max<int64_t>(scaleY, 1);
+    redraw = true;
+}
+
+int LouUI::XYPlot::toPixelX(int32_t x) const {
+    int64_t d = std::max(-maxDeltaX, std::min((int64_t)x - originX,
+                                              maxDeltaX));
+    int64_t p = (d * scaleX + (1LL << 31)) >> 32;
+    return (int)std::max(-PIXEL_LIMIT, std::min(p, PIXEL_LIMIT));
+}
+
+int LouUI::XYPlot::toPixelY(int32_t y) const {
+    int64_t d = std::max(-maxDeltaY, std::min((int64_t)y - originY,
+                                              maxDeltaY));
+    int64_t p = (d * scaleY + (1LL << 31)) >> 32;
+    p = height - 1 - p;
+    return (int)std::max(-PIXEL_LIMIT, std::min(p, PIXEL_LIMIT));
+}
+
+void LouUI::XYPlot::drawSegment(const Series &s, uint32_t from, uint32_t to,
+                                lv_area_t &dirty) {
+    double x0 = toPixelX(s.x[from % s.capacity]);
+    double y0 = toPixelY(s.y[from % s.capacity]);
+    double x1 = toPixelX(s.x[to % s.capacity]);
+    double y1 = toPixelY(s.y[to % s.capacity]);
+    if(!clip(x0, y0, x1, y1, width, height)) return;
+
+    int ax = (int)std::lround(x0);
+    int ay = (int)std::lround(y0);
+    int bx = (int)std::lround(x1);
+    int by = (int)std::lround(y1);
+    dirty.x1 = std::min<lv_coord_t>(dirty.x1, std::min(ax, bx));
+    dirty.y1 = std::min<lv_coord_t>(dirty.y1, std::min(ay, by));
+    dirty.x2 = std::max<lv_coord_t>(dirty.x2, std::max(ax, bx));
+    dirty.y2 = std::max<lv_coord_t>(dirty.y2, std::max(ay, by));
+
+    if(from == to && !s.lines){
+        //a dot is two pixels wide so it can be seen
+        int x = std::min(ax, width - 2);
+        int y = std::min(ay, height - 2);
+        lv_color_t *pixel = buffer + y * width + x;
+        pixel[0] = pixel[1] = pixel[width] = pixel[width + 1] = s.color;
+        dirty.x2 = std::max<lv_coord_t>(dirty.x2, x + 1);
+        dirty.y2 = std::max<lv_coord_t>(dirty.y2, y + 1);
+        return;
+    }
+
+    //Bresenham's line, straight into the canvas buffer
+    int dx = std::abs(bx - ax);
+    int dy = -std::abs(by - ay);
+    int sx = ax < bx ? 1 : -1;
+    int sy = ay < by ? 1 : -1;
+    int err = dx + dy;
+    while(true){
+        buffer[ay * width + ax] = s.color;
+        if(ax == bx && ay == by) break;
+        int e2 = 2 * err;
+        if(e2 >= dy){
+            err += dy;
+            ax += sx;
+        }
+        if(e2 <= dx){
+            err += dx;
+            ay += sy;
+        }
+    }
+}
+
+void LouUI::XYPlot::drawAll() {
+    Pixels::fill(buffer, width * height, background);
+
+    int zeroX = toPixelX(0);
+    if(zeroX >= 0 && zeroX < width){
+        for(int y = 0; y < height; y++) buffer[y * width + zeroX] = axes;
+    }
+    int zeroY = toPixelY(0);
+    if(zeroY >= 0 && zeroY < height){
+        Pixels::fill(buffer + zeroY * width, width, axes);
+    }
+
+    lv_area_t dirty = {0, 0, 0, 0};
+    int count = seriesCount.load(std::memory_order_acquire);
+    for(int n = 0; n < count; n++){
+        Series &s = series[n];
+        uint32_t oldest = s.head > s.capacity ? s.head - s.capacity : 0;
+        for(uint32_t i = oldest; i < s.head; i++){
+            drawSegment(s, s.lines && i > oldest ? i - 1 : i, i, dirty);
+        }
+        s.firstDrawn = oldest;
+        s.drawn = s.head;
+    }
+    lv_obj_invalidate(obj);
+    redraw = false;
+}
+
+void LouUI::XYPlot::update(void *param) {
+    auto *plot = (XYPlot *)param;
+    //the viewport is only waited for by setViewport, never by the ui
+    if(plot->mutex.take(0)){
+        if(plot->viewportChanged) plot->project(plot->viewport);
+        plot->viewportChanged = false;
+        plot->mutex.give();
+    }
+
+    //series below the count are complete and never move
+    int count = plot->seriesCount.load(std::memory_order_acquire);
+    for(int n = 0; n < count; n++){
+        Series &s = plot->series[n];
+        Point p;
+        while(s.pending.pop(p)){
+            if(p.x == CLEAR){
+                s.head = s.drawn = s.firstDrawn = 0;
+                plot->redraw = true;
+                continue;
+            }
+            s.x[s.head % s.capacity] = p.x;
+            s.y[s.head % s.capacity] = p.y;
+            s.head++;
+        }
+        //segments of overwritten points are still on the canvas, so they
+        //are erased once a quarter of the ring has been replaced
+        if(s.head > s.capacity &&
+           s.head - s.capacity >= s.firstDrawn + s.capacity / 4){
+            plot->redraw = true;
+        }
+    }
+    if(plot->redraw){
+        plot->drawAll();
+        return;
+    }
+
+    lv_area_t dirty = {(lv_coord_t)plot->width, (lv_coord_t)plot->height,
+                       -1, -1};
+    for(int n = 0; n < count; n++){
+        Series &s = plot->series[n];
+        uint32_t oldest = s.head > s.capacity ? s.head - s.capacity : 0;
+        for(uint32_t i = std::max(s.drawn, oldest); i < s.head; i++){
+            plot->drawSegment(s, s.lines && i > oldest ? i - 1 : i, i,
+                              dirty);
+        }
+        s.drawn = s.head;
+    }
+
+    //only the box around the new segments is redrawn
+    if(dirty.x2 < dirty.x1) return;
+    lv_area_t coords;
+    lv_obj_get_coords(plot->obj, &coords);
+    dirty.x1 += coords.x1;
+    dirty.x2 += coords.x1;
+    dirty.y1 += coords.y1;
+    dirty.y2 += coords.y1;
+    lv_inv_area(&dirty);
+}
+
+LouUI::XYPlot::Series &LouUI::XYPlot::get(const std::string &name) {
+    int count = seriesCount.load(std::memory_order_acquire);
+    for(int i = 0; i < count; i++){
+        if(series[i].name == name) return series[i];
+    }
+    throw std::invalid_argument("Series does not exist");
+}
+
+LouUI::XYPlot *LouUI::XYPlot::addSeries(std::string name, LouUI::Color c,
+                                        int capacity, bool lines) {
+    if(capacity < 2){
+        throw std::invalid_argument("Series needs room for two points");
+    }
+    mutex.take(TIMEOUT_MAX);
+    int count = seriesCount.load(std::memory_order_relaxed);
+    for(int i = 0; i < count; i++){
+        if(series[i].name == name){
+            mutex.give();
+            throw std::invalid_argument("Series already exists");
+        }
+    }
+    if(count == MAX_SERIES){
+        mutex.give();
+        throw std::invalid_argument("Too many series");
+    }
+    //filled before the count publishes it to the ui and to get()
+    Series &s = series[count];
+    s.name = name;
+    s.x = (int32_t *)(Memory::alloc(sizeof(int32_t) * capacity, "XYPlot",
+                                    obj));
+    s.y = (int32_t *)(Memory::alloc(sizeof(int32_t) * capacity, "XYPlot",
+                                    obj));
+    s.capacity = capacity;
+    s.color = c.toLvColor();
+    s.lines = lines;
+    seriesCount.store(count + 1, std::memory_order_release);
+    mutex.give();
+    return this;
+}
+
+LouUI::XYPlot *LouUI::XYPlot::add(std::string name, double x, double y) {
+    get(name).pending.push({toFixed(x), toFixed(y)});
+    return this;
+}
+
+LouUI::XYPlot *LouUI::XYPlot::clear(std::string name) {
+    get(name).pending.push({CLEAR, 0});
+    return this;
+}
+
+LouUI::XYPlot *LouUI::XYPlot::setViewport(double xMin, double xMax,
+                                          double yMin, double yMax) {
+    if(!(xMax > xMin) || !(yMax > yMin)){
+        throw std::invalid_argument("Viewport is empty");
+    }
+    mutex.take(TIMEOUT_MAX);
+    viewport = {xMin, xMax, yMin, yMax};
+    viewportChanged = true;
+    mutex.give();
+    return this;
+}
+
+uint32_t LouUI::XYPlot::getDropped(std::string name) {
+    return get(name).pending.getDropped();
+}
+
+LouUI::XYPlot *LouUI::XYPlot::setPosition(int x, int y) {
+    lv_obj_set_pos(obj, x, y);
+    return this;
+}
+
+LouUI::XYPlot *LouUI::XYPlot::align(lv_obj_t *ref, LouUI::Align alignType,
+                                    int xShift, int yShift) {
+    lv_obj_align(obj, ref, alignType, xShift, yShift);
+    return this;
+}
+
+lv_obj_t *LouUI::XYPlot::getObj() {
+    return obj;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file XYPlot.hpp
+ * @brief XYPlot class
+ * @details Header file for the XYPlot class, which plots x/y points and paths
+ * @author Kevin Lou
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026 Kevin Lou
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef LOUUI_XYPLOT_HPP
+#define LOUUI_XYPLOT_HPP
+
+#include <atomic>
+#include <string>
+
+#include "../../include/api.h"
+#include "../../include/display/lvgl.h"
+#include "Align.hpp"
+#include "Color.hpp"
+#include "SampleBuffer.hpp"
+
+namespace LouUI {
+    /**
+     * @class XYPlot
+     * @brief Plots series of x/y points, such as planned and actual paths
+     * @details
+     * Each series keeps its newest points in a preallocated ring with one
+     * array of x values and one array of y values, stored as 16.16 fixed
+     * point. add() pushes the point into the series' SampleBuffer without
+     * blocking. An lvgl task moves the points into the rings and draws
+     * only the new segments into the canvas, through a scale and offset
+     * that are only computed when the viewport changes. Changing the
+     * viewport, or wrapping a ring far enough that old segments would be
+     * left on the screen, redraws every point once. Values must be within
+     * +/-32767 to fit the fixed point format.
+     *
+     * Series live in a fixed table that never moves, so series can be
+     * added while other tasks add points. Each series has one producer:
+     * add() for a series should only be called from one task.
+     * @subsection usage Usage
+     * @code
+     * LouUI::XYPlot *plot = new LouUI::XYPlot(screen, 200, 200);
+     * plot->setViewport(-72, 72, -72, 72)
+     *     ->addSeries("planned", LouUI::Color("GRAY"))
+     *     ->addSeries("actual", LouUI::Color("RED"));
+     * //in the odometry loop
+     * plot->add("actual", x, y);
+     * @endcode
+     */
+    class XYPlot {
+    public:
+
+        /**
+         * Maximum number of series
+         */
+        static constexpr int MAX_SERIES = 8;
+
+    private:
+        struct Point {
+            int32_t x;
+            int32_t y;
+        };
+
+        struct Viewport {
+            double xMin;
+            double xMax;
+            double yMin;
+            double yMax;
+        };
+
+        struct Series {
+            std::string name;
+            SampleBuffer<Point, 64> pending;
+            int32_t *x;
+            int32_t *y;
+            uint32_t capacity;
+            uint32_t head = 0;
+            uint32_t drawn = 0;
+            uint32_t firstDrawn = 0;
+            lv_color_t color;
+            bool lines = true;
+        };
+
+        lv_obj_t *obj;
+        lv_color_t *buffer;
+        lv_color_t background;
+        lv_color_t axes;
+        lv_task_t *updater;
+        Series series[MAX_SERIES];
+        std::atomic<int> seriesCount{0};
+        pros::Mutex mutex;
+        Viewport viewport = {0, 1, 0, 1};
+        bool viewportChanged = false;
+        int width;
+        int height;
+
+        //cached transform from fixed point values to pixels
+        int32_t originX = 0;
+        int32_t originY = 0;
+        int64_t scaleX = 0;
+        int64_t scaleY = 0;
+        int64_t maxDeltaX = 0;
+        int64_t maxDeltaY = 0;
+        bool redraw = true;
+
+        void project(const Viewport &v);
+        int toPixelX(int32_t x) const;
+        int toPixelY(int32_t y) const;
+        void drawSegment(const Series &s, uint32_t from, uint32_t to,
+                         lv_area_t &dirty);
+        void drawAll();
+        static void update(void *param);
+        Series &get(const std::string &name);
+
+    public:
+
+        /**
+         * Creates a new plot with a viewport from 0 to 1 on both axes
+         * @param parent The object the plot is created in
+         * @param width The width in pixels
+         * @param height The height in pixels
+         */
+        XYPlot(lv_obj_t *parent, int width, int height);
+
+        /**
+         * Deletes the canvas and frees its buffer and every series' ring
+         */
+        ~XYPlot();
+
+        /**
+         * Adds a series
+         * @param name The name of the series
+         * @param c The color of the series
+         * @param capacity The number of newest points kept and drawn
+         * @param lines Whether the points are joined with lines or drawn
+         * as separate dots
+         */
+        XYPlot* addSeries(std::string name, LouUI::Color c,
+                          int capacity = 512, bool lines = true);
+
+        /**
+         * Adds a point to a series. Safe to call from one task per series
+         */
+        XYPlot* add(std::string name, double x, double y);
+
+        /**
+         * Removes every point of a series. Called from the task that adds
+         * its points
+         */
+        XYPlot* clear(std::string name);
+
+        /**
+         * Sets the values shown at the edges of the plot. Every point is
+         * projected again on the next update
+         */
+        XYPlot* setViewport(double xMin, double xMax, double yMin,
+                            double yMax);
+
+        /**
+         * Gets the number of points of a series dropped because the plot
+         * was not drawn in time
+         */
+        uint32_t getDropped(std::string name);
+
+        XYPlot* setPosition(int x, int y);
+
+        /**
+         * Aligns the plot
+         * @param ref object to align to
+         * @param alignType type of alignment
+         * @param xShift pixels to shift in the x-direction
+         * @param yShift pixels to shift in the y-direction
+         */
+        XYPlot* align(lv_obj_t *ref, Align alignType, int xShift = 0,
+                      int yShift = 0);
+
+        lv_obj_t *getObj();
+    };
+}
+
+
+#endif //LOUUI_XYPLOT_HPP
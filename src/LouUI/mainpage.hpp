@@ -89,6 +89,13 @@
  *                ->setColor(Color("BLUE"));
  * @endcode
  *
+ * @subsubsection layouts Layouts
+ * Screens with many buttons can instead be described as a constexpr table
+ * of widgets and shared styles. Positions aligned to other widgets are
+ * resolved at compile time, and the screen is built in one pass. This is
+ * further detailed in documentation for the `Layout` namespace, and
+ * `main.cpp` builds its auton selector this way.
+ *
  * @section example Example UI
  *
  * Below is an example of how a simple UI with a button and a label that
@@ -186,6 +193,16 @@
  * button->setAction(incrementCounter);
  * @endcode
  *
+ * Alternatively, a lambda can be used as the action. Its captures are stored
+ * inside the button, so the label can be updated without a global function:
+ *
+ * @code
+ * button->setAction([label]{
+ *     counter++;
+ *     label->setText("Counter: " + std::to_string(counter));
+ * });
+ * @endcode
+ *
  * @subsubsection running Step 5: Running Project
  *
  * The project can be run just like any other PROS project (i.e. `pros mu`).
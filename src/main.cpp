@@ -31,6 +31,7 @@
 #include "LouUI/Button.hpp"
 #include "Autonomous.hpp"
 #include "UIFuncs.hpp"
+#include "LouUI/Layout.hpp"
 
 LouUI::Display display;
 LouUI::ToggleButton* leftButton = nullptr;
@@ -51,6 +52,60 @@ LouUI::Label* autonDescription = nullptr;
 
 LouUI::Chart* chart = nullptr;
 
+/**
+ * Layout of the auton selector screen
+ */
+namespace AutonSelector {
+    using namespace LouUI::Layout;
+
+    enum Widgets{
+        LEFT,
+        RIGHT,
+        PROG,
+        AUTON1,
+        AUTON2,
+        AUTON3,
+        AUTON4,
+        DESCRIPTION
+    };
+
+    enum Styles{
+        SIDE_STYLE,
+        PROG_STYLE
+    };
+
+    constexpr ButtonStyle styles[] = {
+        {{125, 125, 125}, {140, 140, 140}, {255, 255, 255}, 255, 5, 0},
+        {{0, 125, 0}, {0, 140, 0}, {255, 255, 255}, 255, 5, 0},
+    };
+
+    constexpr auto widgets = resolve({
+        toggleButton().at(27, 0).size(120, 40).withStyle(SIDE_STYLE)
+                .withText("LEFT").withFastAction(selectLeft),
+        toggleButton().size(120, 40).withStyle(SIDE_STYLE)
+                .align(LEFT, LouUI::OUT_RIGHT_MID, 20, 0)
+                .withText("RIGHT").withFastAction(selectRight),
+        toggleButton().size(120, 40).withStyle(PROG_STYLE)
+                .align(RIGHT, LouUI::OUT_RIGHT_MID, 20, 0)
+                .withText("PROG").withFastAction(selectProg),
+        toggleButton().at(5, 60).size(100, 40).withStyle(SIDE_STYLE)
+                .withText("1").withFastAction(selectAuton1),
+        toggleButton().size(100, 40).withStyle(SIDE_STYLE)
+                .align(AUTON1, LouUI::OUT_RIGHT_MID, 10, 0)
+                .withText("2").withFastAction(selectAuton2),
+        toggleButton().size(100, 40).withStyle(SIDE_STYLE)
+                .align(AUTON2, LouUI::OUT_RIGHT_MID, 10, 0)
+                .withText("3").withFastAction(selectAuton3),
+        toggleButton().size(100, 40).withStyle(SIDE_STYLE)
+                .align(AUTON3, LouUI::OUT_RIGHT_MID, 10, 0)
+                .withText("4").withFastAction(selectAuton4),
+        label().size(440, -1)
+                .withTextAlign(LouUI::Label::LEFT)
+                .withLongMode(LouUI::Label::BREAK)
+                .align(SCREEN, LouUI::CENTER, 0, 55),
+    });
+}
+
 /**
  * Runs initialization code. This occurs as soon as the program is started.
  *
@@ -63,70 +118,26 @@ void initialize() {
     display.addScreen("Chart");
 
     //create components
-    leftButton = (new LouUI::ToggleButton(display.getScreen("Auton Selector")))
-            ->setPosition(27, 0)
-            ->setSize(120, 40)
-            ->setMainColor(LouUI::Color(140,140,140), LouUI::ToggleButton::ALL_PRESSED)
-            ->setGradientColor(LouUI::Color(140,140,140), LouUI::ToggleButton::ALL_PRESSED)
-            ->setMainColor(LouUI::Color(125, 125, 125), LouUI::ToggleButton::ALL_RELEASED)
-            ->setGradientColor(LouUI::Color(125, 125, 125), LouUI::ToggleButton::ALL_RELEASED)
-            ->setBorderColor(LouUI::Color("WHITE"), LouUI::ToggleButton::ALL)
-            ->setBorderOpacity(255, LouUI::ToggleButton::ALL)
-            ->setBorderWidth(5, LouUI::ToggleButton::ALL_TOGGLED)
-            ->setBorderWidth(0, LouUI::ToggleButton::ALL_UNTOGGLED);
-    rightButton = (new LouUI::ToggleButton(display.getScreen("Auton Selector"), *leftButton))
-            ->align(leftButton->getObj(), LouUI::OUT_RIGHT_MID, 20, 0);
-    progButton = (new LouUI::ToggleButton(display.getScreen("Auton Selector")))
-            ->setSize(120, 40)
-            ->setMainColor(LouUI::Color(0,140,0), LouUI::ToggleButton::ALL_PRESSED)
-            ->setGradientColor(LouUI::Color(0,140,0), LouUI::ToggleButton::ALL_PRESSED)
-            ->setMainColor(LouUI::Color(0, 125, 0), LouUI::ToggleButton::ALL_RELEASED)
-            ->setGradientColor(LouUI::Color(0, 125, 0), LouUI::ToggleButton::ALL_RELEASED)
-            ->setBorderColor(LouUI::Color("WHITE"), LouUI::ToggleButton::ALL)
-            ->setBorderOpacity(255, LouUI::ToggleButton::ALL)
-            ->setBorderWidth(5, LouUI::ToggleButton::ALL_TOGGLED)
-            ->setBorderWidth(0, LouUI::ToggleButton::ALL_UNTOGGLED)
-            ->align(rightButton->getObj(), LouUI::OUT_RIGHT_MID, 20, 0);
-
-    auton1Button = (new LouUI::ToggleButton(display.getScreen("Auton Selector"), *leftButton))
-            ->setPosition(5, 60)
-            ->setSize(100, 40);
-    auton2Button = (new LouUI::ToggleButton(display.getScreen("Auton Selector"), *auton1Button))
-            ->align(auton1Button->getObj(), LouUI::OUT_RIGHT_MID, 10, 0);
-    auton3Button = (new LouUI::ToggleButton(display.getScreen("Auton Selector"), *auton1Button))
-            ->align(auton2Button->getObj(), LouUI::OUT_RIGHT_MID, 10, 0);
-    auton4Button = (new LouUI::ToggleButton(display.getScreen("Auton Selector"), *auton1Button))
-            ->align(auton3Button->getObj(), LouUI::OUT_RIGHT_MID, 10, 0);
-
-    leftButtonLabel = (new LouUI::Label(leftButton->getObj()))
-            ->setText("LEFT");
-    rightButtonLabel = (new LouUI::Label(rightButton->getObj()))
-            ->setText("RIGHT");
-    progButtonLabel = (new LouUI::Label(progButton->getObj()))
-            ->setText("PROG");
-    auton1ButtonLabel = (new LouUI::Label(auton1Button->getObj()))
-            ->setText("1");
-    auton2ButtonLabel = (new LouUI::Label(auton2Button->getObj()))
-            ->setText("2");
-    auton3ButtonLabel = (new LouUI::Label(auton3Button->getObj()))
-            ->setText("3");
-    auton4ButtonLabel = (new LouUI::Label(auton4Button->getObj()))
-            ->setText("4");
-
-    leftButton->setAction(selectLeft);
-    rightButton->setAction(selectRight);
-    progButton->setAction(selectProg);
-
-    auton1Button->setAction(selectAuton1);
-    auton2Button->setAction(selectAuton2);
-    auton3Button->setAction(selectAuton3);
-    auton4Button->setAction(selectAuton4);
-
-    autonDescription = (new LouUI::Label(display.getScreen("Auton Selector")))
-            ->setTextAlign(LouUI::Label::LEFT)
-            ->setLongMode(LouUI::Label::BREAK)
-            ->setWidth(440)
-            ->align(display.getScreen("Auton Selector"), LouUI::CENTER, 0, 55)
+    LouUI::Layout::Screen autonSelector(display.getScreen("Auton Selector"),
+                                        AutonSelector::widgets,
+                                        AutonSelector::styles);
+    leftButton = autonSelector.getToggleButton(AutonSelector::LEFT);
+    rightButton = autonSelector.getToggleButton(AutonSelector::RIGHT);
+    progButton = autonSelector.getToggleButton(AutonSelector::PROG);
+    auton1Button = autonSelector.getToggleButton(AutonSelector::AUTON1);
+    auton2Button = autonSelector.getToggleButton(AutonSelector::AUTON2);
+    auton3Button = autonSelector.getToggleButton(AutonSelector::AUTON3);
+    auton4Button = autonSelector.getToggleButton(AutonSelector::AUTON4);
+
+    leftButtonLabel = autonSelector.getLabel(AutonSelector::LEFT);
+    rightButtonLabel = autonSelector.getLabel(AutonSelector::RIGHT);
+    progButtonLabel = autonSelector.getLabel(AutonSelector::PROG);
+    auton1ButtonLabel = autonSelector.getLabel(AutonSelector::AUTON1);
+    auton2ButtonLabel = autonSelector.getLabel(AutonSelector::AUTON2);
+    auton3ButtonLabel = autonSelector.getLabel(AutonSelector::AUTON3);
+    auton4ButtonLabel = autonSelector.getLabel(AutonSelector::AUTON4);
+
+    autonDescription = autonSelector.getLabel(AutonSelector::DESCRIPTION)
             ->setText(Autonomous::noAutonDescription);
 
     chart = (new LouUI::Chart(display.getScreen("Chart")))
@@ -0,0 +1,301 @@
+#!/usr/bin/env python3
+"""
+@file fontpack.py
+@brief Font subsetting and packing tool for LouUI
+@details Reads a full LVGL 5.3 font source file (as produced by the LittlevGL
+font converter), keeps only the requested glyphs, re-quantizes the glyph
+bitmaps to the requested bit depth and writes a compact font source file
+without the ASCII-art comments.
+
+The glyph set is built from any combination of:
+ - --range  comma separated code points or ranges (e.g. 0x20-0x7e,0xf078)
+ - --scan   directories whose C/C++ string and character literals are scanned
+            for the code points they actually use
+
+Usage:
+    fontpack.py INPUT.c OUTPUT.c --name dejavu_20 --bpp 4 --range 0x20-0x7e
+@author Kevin Lou
+@date October 19, 2026
+
+@copyright Copyright (c) 2021 Kevin Lou
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SOURCE_EXTS = ('.c', '.cpp', '.cc', '.h', '.hpp')
+
+
+def parse_font(path):
+    """Parses an LVGL 5.3 font source file into a list of glyphs"""
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+
+    bitmap_body = re.search(r'_glyph_bitmap\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    dsc_body = re.search(r'_glyph_dsc\[\]\s*=\s*\{(.*?)\};', text, re.S)
+    if not bitmap_body or not dsc_body:
+        sys.exit('fontpack: {} is not an LVGL font source'.format(path))
+
+    # strip the ASCII-art and header comments before reading the bytes
+    bitmap_src = re.sub(r'/\*.*?\*/|//[^\n]*', '', bitmap_body.group(1),
+                        flags=re.S)
+    bitmap = bytes(int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]{2}',
+                                                  bitmap_src))
+
+    h_px = int(re.search(r'\.h_px\s*=\s*(\d+)', text).group(1))
+    bpp = int(re.search(r'\.bpp\s*=\s*(\d+)', text).group(1))
+    monospace = int(re.search(r'\.monospace\s*=\s*(\d+)', text).group(1))
+
+    glyphs = []
+    dsc = re.compile(r'\.w_px\s*=\s*(\d+),\s*\.glyph_index\s*=\s*(\d+)\s*\},'
+                     r'\s*/\*(?:Unicode: )?U\+([0-9a-fA-F]+)')
+    for m in dsc.finditer(dsc_body.group(1)):
+        w_px, index, unicode = int(m.group(1)), int(m.group(2)), \
+            int(m.group(3), 16)
+        row_bytes = (w_px * bpp + 7) // 8
+        data = bitmap[index:index + row_bytes * h_px]
+        glyphs.append({'unicode': unicode, 'w_px': w_px,
+                       'pixels': unpack(data, w_px, h_px, bpp)})
+
+    return {'h_px': h_px, 'bpp': bpp, 'monospace': monospace,
+            'glyphs': glyphs}
+
+
+def unpack(data, w_px, h_px, bpp):
+    """Expands a byte-aligned glyph bitmap into rows of pixel values"""
+    row_bytes = (w_px * bpp + 7) // 8
+    per_byte = 8 // bpp
+    mask = (1 << bpp) - 1
+    rows = []
+    for y in range(h_px):
+        row = []
+        for x in range(w_px):
+            byte = data[y * row_bytes + x // per_byte]
+            shift = 8 - bpp * (x % per_byte + 1)
+            row.append((byte >> shift) & mask)
+        rows.append(row)
+    return rows
+
+
+def pack(rows, w_px, src_bpp, dst_bpp):
+    """Re-quantizes pixel rows to dst_bpp and packs them byte-aligned"""
+    src_max = (1 << src_bpp) - 1
+    dst_max = (1 << dst_bpp) - 1
+    per_byte = 8 // dst_bpp
+    out = bytearray()
+    for row in rows:
+        byte, count = 0, 0
+        for v in row:
+            q = (v * dst_max + src_max // 2) // src_max
+            byte = (byte << dst_bpp) | q
+            count += 1
+            if count == per_byte:
+                out.append(byte)
+                byte, count = 0, 0
+        if count:
+            out.append(byte << (dst_bpp * (per_byte - count)))
+    return bytes(out)
+
+
+def parse_ranges(spec):
+    """Parses '0x20-0x7e,0xf078' style code point lists"""
+    points = set()
+    for part in filter(None, (p.strip() for p in spec.split(','))):
+        if '-' in part:
+            lo, hi = part.split('-', 1)
+            points.update(range(int(lo, 0), int(hi, 0) + 1))
+        else:
+            points.add(int(part, 0))
+    return points
+
+
+def decode_literal(body):
+    """Decodes the escapes of a C string literal body into code points.
+    \\x and octal escapes are bytes of the UTF-8 text, as in the lvgl
+    SYMBOL_* strings, so they are decoded together with the plain text"""
+    escape = re.compile(r'\\(?:x([0-9a-fA-F]+)|([0-7]{1,3})|'
+                        r'u([0-9a-fA-F]{4})|U([0-9a-fA-F]{8})|(.))', re.S)
+    simple = {'n': 10, 't': 9, 'r': 13, 'a': 7, 'b': 8, 'f': 12,
+              'v': 11, '\\': 92, "'": 39, '"': 34, '?': 63}
+    data = bytearray()
+    at = 0
+    for e in escape.finditer(body):
+        data += body[at:e.start()].encode('utf-8')
+        at = e.end()
+        if e.group(1) or e.group(2):
+            value = int(e.group(1), 16) if e.group(1) else int(e.group(2), 8)
+            data.append(value & 0xFF)
+        elif e.group(3) or e.group(4):
+            data += chr(int(e.group(3) or e.group(4), 16)).encode('utf-8')
+        elif e.group(5) in simple:
+            data.append(simple[e.group(5)])
+    data += body[at:].encode('utf-8')
+    return set(ord(c) for c in data.decode('utf-8', errors='ignore'))
+
+
+def scan_sources(dirs):
+    """Collects every code point used in string or character literals"""
+    literal = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'')
+    points = set()
+    for d in dirs:
+        for root, _, files in os.walk(d):
+            for name in files:
+                if not name.endswith(SOURCE_EXTS):
+                    continue
+                with open(os.path.join(root, name), encoding='utf-8',
+                          errors='ignore') as f:
+                    src = f.read()
+                for m in literal.finditer(src):
+                    s = m.group(1) if m.group(1) is not None else m.group(2)
+                    points |= decode_literal(s)
+    return points
+
+
+def write_font(path, name, font, glyphs, bpp, source):
+    first = glyphs[0]['unicode']
+    last = glyphs[-1]['unicode']
+    continuous = last - first + 1 == len(glyphs)
+
+    out = []
+    out.append('')
+    out.append('#include "../../../include/display/lvgl.h"')
+    out.append('')
+    out.append('/' + '*' * 83)
+    out.append(' * {} px font, {} glyphs in U+{:04x} .. U+{:04x} with {} bpp'
+               .format(font['h_px'], len(glyphs), first, last, bpp))
+    out.append(' * Generated by tools/fontpack.py from {}. Do not edit; run '
+               '`make fonts` instead.'.format(source))
+    out.append('*' * 83 + '/')
+    out.append('')
+    out.append('/*Store the image of the letters (glyph)*/')
+    out.append('static const uint8_t {}_glyph_bitmap[] = '.format(name))
+    out.append('{')
+
+    dsc = []
+    index = 0
+    for g in glyphs:
+        data = pack(g['pixels'], g['w_px'], font['bpp'], bpp)
+        out.append('  /*U+{:04x}*/'.format(g['unicode']))
+        for i in range(0, len(data), 16):
+            out.append('  ' + ' '.join('0x{:02x},'.format(b)
+                                       for b in data[i:i + 16]))
+        dsc.append((g['w_px'], index, g['unicode']))
+        index += len(data)
+    out.append('};')
+    out.append('')
+    out.append('/*Store the glyph descriptions*/')
+    out.append('static const lv_font_glyph_dsc_t {}_glyph_dsc[] = '
+               .format(name))
+    out.append('{')
+    for w_px, i, u in dsc:
+        out.append('  {{.w_px = {},\t.glyph_index = {}}},\t/*U+{:04x}*/'
+                   .format(w_px, i, u))
+    out.append('};')
+    out.append('')
+
+    if not continuous:
+        out.append('/*List of unicode characters*/')
+        out.append('static const uint32_t {}_unicode_list[] = {{'.format(name))
+        for g in glyphs:
+            out.append('  {},'.format(g['unicode']))
+        out.append('  0,    /*End indicator*/')
+        out.append('};')
+        out.append('')
+
+    kind = 'continuous' if continuous else 'sparse'
+    out.append('lv_font_t {} = '.format(name))
+    out.append('{')
+    out.append('    .unicode_first = {},\t/*First Unicode letter in this '
+               'font*/'.format(first))
+    out.append('    .unicode_last = {},\t/*Last Unicode letter in this '
+               'font*/'.format(last))
+    out.append('    .h_px = {},\t\t\t\t/*Font height in pixels*/'
+               .format(font['h_px']))
+    out.append('    .glyph_bitmap = {}_glyph_bitmap,\t/*Bitmap of glyphs*/'
+               .format(name))
+    out.append('    .glyph_dsc = {}_glyph_dsc,\t\t/*Description of glyphs*/'
+               .format(name))
+    out.append('    .glyph_cnt = {},\t\t\t/*Number of glyphs in the font*/'
+               .format(len(glyphs)))
+    if continuous:
+        out.append('    .unicode_list = NULL,\t/*Every character in the font '
+                   'from \'unicode_first\' to \'unicode_last\'*/')
+    else:
+        out.append('    .unicode_list = {}_unicode_list,\t/*List of unicode '
+                   'characters*/'.format(name))
+    out.append('    .get_bitmap = lv_font_get_bitmap_{},\t/*Function pointer '
+               'to get glyph\'s bitmap*/'.format(kind))
+    out.append('    .get_width = lv_font_get_width_{},\t/*Function pointer to '
+               'get glyph\'s width*/'.format(kind))
+    out.append('    .bpp = {},\t\t\t\t/*Bit per pixel*/'.format(bpp))
+    out.append('    .monospace = {},\t\t\t\t/*Fix width (0: if not used)*/'
+               .format(font['monospace']))
+    out.append('    .next_page = NULL,\t\t/*Pointer to a font extension*/')
+    out.append('};')
+    out.append('')
+
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+    return index
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Subset and pack an LVGL '
+                                                 'font for LouUI')
+    parser.add_argument('input', help='full LVGL font source file')
+    parser.add_argument('output', help='compact font source file to write')
+    parser.add_argument('--name', required=True, help='font variable name')
+    parser.add_argument('--bpp', type=int, choices=(1, 2, 4), default=4,
+                        help='output bits per pixel')
+    parser.add_argument('--range', default='',
+                        help='code points to always keep (e.g. 0x20-0x7e)')
+    parser.add_argument('--scan', action='append', default=[],
+                        help='source directory to scan for used code points')
+    args = parser.parse_args()
+
+    font = parse_font(args.input)
+    if args.bpp > font['bpp']:
+        sys.exit('fontpack: cannot pack a {} bpp font at {} bpp'
+                 .format(font['bpp'], args.bpp))
+
+    wanted = parse_ranges(args.range) | scan_sources(args.scan)
+    glyphs = sorted((g for g in font['glyphs'] if g['unicode'] in wanted),
+                    key=lambda g: g['unicode'])
+    if not glyphs:
+        # an LVGL font needs a glyph, so an unused font keeps its first one
+        glyphs = [min(font['glyphs'], key=lambda g: g['unicode'])]
+        print('fontpack: {}: no glyphs are used, keeping U+{:04x}'
+              .format(args.name, glyphs[0]['unicode']))
+
+    before = sum(((g['w_px'] * font['bpp'] + 7) // 8) * font['h_px']
+                 for g in font['glyphs'])
+    after = write_font(args.output, args.name, font, glyphs, args.bpp,
+                       os.path.relpath(args.input,
+                                       os.path.dirname(os.path.dirname(
+                                           os.path.abspath(__file__)))))
+    print('fontpack: {}: {}/{} glyphs, {} -> {} bitmap bytes'
+          .format(args.name, len(glyphs), len(font['glyphs']), before, after))
+
+
+if __name__ == '__main__':
+    main()
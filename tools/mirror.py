@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+"""
+@file mirror.py
+@brief Host decoder for LouUI's ScreenMirror stream
+@details Reads the brain's USB serial output, takes the ScreenMirror frames
+out of the PROS stdout stream and redraws them into a 480x240 framebuffer,
+which is saved as a PNG after every batch of frames. Anything else printed
+to stdout is passed through to the terminal.
+
+With --golden, the last frame of a captured stream is compared with a
+golden PNG, and the exit status is 1 when any pixel differs, so a capture
+of a screen can be checked for visual regressions. --update writes the
+golden PNG instead.
+
+The PROS kernel wraps every write in a COBS packet that starts with a four
+byte stream name ("sout", "serr", ...). Use --raw for a stream that was
+captured without that wrapping, e.g. with COBS disabled on the brain.
+
+Usage:
+    mirror.py /dev/ttyACM1 --out screen.png
+    mirror.py capture.bin --raw --out screen.png
+    mirror.py capture.bin --golden tests/home.png
+@author Kevin Lou
+@date October 19, 2026
+
+@copyright Copyright (c) 2021 Kevin Lou
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+WIDTH = 480
+HEIGHT = 240
+HEADER = 15
+
+
+def cobs_decode(packet):
+    """Decodes one COBS packet, without its 0x00 delimiter"""
+    out = bytearray()
+    i = 0
+    while i < len(packet):
+        code = packet[i]
+        if code == 0:
+            raise ValueError('zero byte in COBS packet')
+        out += packet[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(packet):
+            out.append(0)
+    return bytes(out)
+
+
+class Mirror:
+    """Framebuffer rebuilt from ScreenMirror frames"""
+
+    def __init__(self):
+        self.pixels = bytearray(WIDTH * HEIGHT * 3)
+        self.stream = bytearray()
+        self.frames = 0
+        self.errors = 0
+
+    def feed(self, data):
+        """Adds stdout bytes and applies every complete frame in them.
+        Returns the bytes that were not part of a frame"""
+        self.stream += data
+        text = bytearray()
+        while True:
+            start = self.stream.find(b'LM')
+            if start < 0:
+                # keep a trailing 'L' that may start the next magic
+                keep = 1 if self.stream.endswith(b'L') else 0
+                text += self.stream[:len(self.stream) - keep]
+                del self.stream[:len(self.stream) - keep]
+                return bytes(text)
+            text += self.stream[:start]
+            del self.stream[:start]
+            if len(self.stream) < HEADER:
+                return bytes(text)
+            kind, x, y, w, h, length = struct.unpack_from('<BHHHHI',
+                                                          self.stream, 2)
+            if (kind not in (1, 2) or x + w > WIDTH or y + h > HEIGHT or
+                    (kind == 1 and length % 4) or
+                    (kind == 2 and length != w * h * 3)):
+                # not a frame, e.g. "LM" in printed text
+                text += self.stream[:1]
+                del self.stream[:1]
+                continue
+            if len(self.stream) < HEADER + length + 2:
+                return bytes(text)
+            data = self.stream[HEADER:HEADER + length]
+            (checksum,) = struct.unpack_from('<H', self.stream,
+                                             HEADER + length)
+            if sum(data) & 0xFFFF != checksum:
+                self.errors += 1
+                text += self.stream[:1]
+                del self.stream[:1]
+                continue
+            if kind == 1:
+                self.draw(x, y, w, h, data)
+            else:
+                self.draw_raw(x, y, w, h, data)
+            del self.stream[:HEADER + length + 2]
+
+    def draw(self, x, y, w, h, runs):
+        """Draws the runs of one area into the framebuffer"""
+        i = 0
+        for r in range(0, len(runs), 4):
+            count, b, g, red = runs[r], runs[r + 1], runs[r + 2], runs[r + 3]
+            for _ in range(count + 1):
+                px, py = x + i % w, y + i // w
+                if py >= y + h:
+                    break
+                at = (py * WIDTH + px) * 3
+                self.pixels[at:at + 3] = bytes((red, g, b))
+                i += 1
+        self.frames += 1
+
+    def draw_raw(self, x, y, w, h, data):
+        """Draws the raw blue, green, red pixels of one area"""
+        for row in range(h):
+            at = ((y + row) * WIDTH + x) * 3
+            line = data[row * w * 3:(row + 1) * w * 3]
+            # swap blue and red of every pixel
+            self.pixels[at:at + w * 3] = bytes(
+                b for i in range(0, len(line), 3)
+                for b in (line[i + 2], line[i + 1], line[i]))
+        self.frames += 1
+
+    def save(self, path):
+        """Saves the framebuffer as a PNG"""
+        rows = b''.join(b'\x00' + bytes(self.pixels[y * WIDTH * 3:
+                                                     (y + 1) * WIDTH * 3])
+                        for y in range(HEIGHT))
+
+        def chunk(kind, data):
+            return (struct.pack('>I', len(data)) + kind + data +
+                    struct.pack('>I', zlib.crc32(kind + data) & 0xFFFFFFFF))
+
+        png = (b'\x89PNG\r\n\x1a\n' +
+               chunk(b'IHDR', struct.pack('>IIBBBBB', WIDTH, HEIGHT, 8, 2,
+                                          0, 0, 0)) +
+               chunk(b'IDAT', zlib.compress(rows)) + chunk(b'IEND', b''))
+        with open(path, 'wb') as f:
+            f.write(png)
+
+
+def load_png(path):
+    """Loads a 480x240 8-bit RGB PNG, as written by Mirror.save"""
+    with open(path, 'rb') as f:
+        png = f.read()
+    if png[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('{} is not a PNG'.format(path))
+    at = 8
+    header = None
+    data = bytearray()
+    while at < len(png):
+        (length,) = struct.unpack_from('>I', png, at)
+        kind = png[at + 4:at + 8]
+        body = png[at + 8:at + 8 + length]
+        if kind == b'IHDR':
+            header = struct.unpack('>IIBBBBB', body)
+        elif kind == b'IDAT':
+            data += body
+        at += length + 12
+    if header != (WIDTH, HEIGHT, 8, 2, 0, 0, 0):
+        raise ValueError('{} is not a {}x{} RGB PNG'.format(path, WIDTH,
+                                                            HEIGHT))
+    rows = zlib.decompress(bytes(data))
+    stride = WIDTH * 3
+    pixels = bytearray(HEIGHT * stride)
+    for y in range(HEIGHT):
+        kind = rows[y * (stride + 1)]
+        row = rows[y * (stride + 1) + 1:(y + 1) * (stride + 1)]
+        out = pixels[y * stride:(y + 1) * stride]
+        prior = pixels[(y - 1) * stride:y * stride] if y else bytes(stride)
+        for i in range(stride):
+            left = out[i - 3] if i >= 3 else 0
+            up = prior[i]
+            corner = prior[i - 3] if i >= 3 else 0
+            if kind == 0:
+                guess = 0
+            elif kind == 1:
+                guess = left
+            elif kind == 2:
+                guess = up
+            elif kind == 3:
+                guess = (left + up) // 2
+            else:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                guess = (left if pa <= pb and pa <= pc else
+                         up if pb <= pc else corner)
+            out[i] = (row[i] + guess) & 0xFF
+        pixels[y * stride:(y + 1) * stride] = out
+    return pixels
+
+
+def differences(pixels, golden):
+    """Counts the pixels that differ between two framebuffers"""
+    return sum(1 for i in range(0, len(pixels), 3)
+               if pixels[i:i + 3] != golden[i:i + 3])
+
+
+def stdout_bytes(source, raw):
+    """Yields the bytes of the brain's stdout from the serial data"""
+    if raw:
+        while True:
+            data = source.read(4096)
+            if not data:
+                return
+            yield data
+    packet = bytearray()
+    while True:
+        data = source.read(4096)
+        if not data:
+            return
+        for byte in data:
+            if byte != 0:
+                packet.append(byte)
+                continue
+            try:
+                decoded = cobs_decode(bytes(packet))
+            except ValueError:
+                decoded = b''
+            packet.clear()
+            if decoded[:4] == b'sout':
+                yield decoded[4:]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Rebuild the brain screen '
+                                     'from the LouUI ScreenMirror stream')
+    parser.add_argument('source', help='serial port or captured stream')
+    parser.add_argument('--out', default='screen.png',
+                        help='PNG written after every batch of frames')
+    parser.add_argument('--raw', action='store_true',
+                        help='the stream is not wrapped in PROS packets')
+    parser.add_argument('--golden',
+                        help='PNG the last frame is compared with')
+    parser.add_argument('--update', action='store_true',
+                        help='write the last frame to the --golden PNG')
+    args = parser.parse_args()
+
+    mirror = Mirror()
+    with open(args.source, 'rb', buffering=0) as source:
+        for data in stdout_bytes(source, args.raw):
+            frames = mirror.frames
+            text = mirror.feed(data)
+            if text:
+                sys.stdout.write(text.decode('utf-8', 'replace'))
+                sys.stdout.flush()
+            if mirror.frames != frames:
+                mirror.save(args.out)
+    if mirror.errors:
+        print('mirror: {} frames failed the checksum'.format(mirror.errors),
+              file=sys.stderr)
+    if args.golden and args.update:
+        mirror.save(args.golden)
+    elif args.golden:
+        changed = differences(mirror.pixels, load_png(args.golden))
+        if changed:
+            print('mirror: {} pixels differ from {}'.format(changed,
+                                                            args.golden),
+                  file=sys.stderr)
+            sys.exit(1)
+        print('mirror: matches {}'.format(args.golden), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
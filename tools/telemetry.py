@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+"""
+@file telemetry.py
+@brief Host decoder for LouUI's TelemetryStream
+@details Decodes the binary telemetry frames that TelemetryStream writes to
+the brain's stdout. It can be used as a library (Decoder) or run as a tool
+that writes the samples as CSV, optionally replaying a captured stream at
+the speed it was recorded.
+
+Usage:
+    telemetry.py /dev/ttyACM1 --csv run.csv
+    telemetry.py capture.bin --replay
+@author Kevin Lou
+@date October 19, 2026
+
+@copyright Copyright (c) 2021 Kevin Lou
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+"""
+
+import argparse
+import struct
+import sys
+import time
+
+from mirror import cobs_decode, stdout_bytes
+
+SCHEMA = 1
+SAMPLES = 2
+TYPES = {1: ('<h', 2), 2: ('<i', 4), 3: ('<f', 4)}
+
+
+def crc16(data):
+    """CRC-16-CCITT, polynomial 0x1021, starting at 0xFFFF"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+
+class Sample:
+    """Values of every field at one time"""
+
+    def __init__(self, time_ms, sequence, values):
+        self.time = time_ms
+        self.sequence = sequence
+        self.values = values
+
+
+class Decoder:
+    """Turns the stdout bytes of the brain into Samples.
+
+    Frames are only decoded once a schema has been received, which the brain
+    sends every 2 seconds. Bytes between frames are kept as text."""
+
+    def __init__(self):
+        self.fields = None
+        self.pending = bytearray()
+        self.text = bytearray()
+        self.errors = 0
+        self.lost = 0
+        self.last_sequence = None
+
+    def feed(self, data):
+        """Adds stdout bytes and returns the Samples completed by them"""
+        samples = []
+        self.pending += data
+        while True:
+            end = self.pending.find(b'\x00')
+            if end < 0:
+                return samples
+            chunk = bytes(self.pending[:end])
+            del self.pending[:end + 1]
+            if not chunk:
+                continue
+            sample = self.decode(chunk)
+            if sample:
+                samples.append(sample)
+
+    def decode(self, chunk):
+        """Decodes one chunk between delimiters, or keeps it as text"""
+        try:
+            frame = cobs_decode(chunk)
+        except ValueError:
+            frame = b''
+        if len(frame) < 3 or crc16(frame[:-2]) != \
+                struct.unpack_from('<H', frame, len(frame) - 2)[0]:
+            if not all(32 <= b < 127 or b in b'\t\r\n' for b in chunk):
+                self.errors += 1
+            self.text += chunk
+            return None
+        body = frame[:-2]
+        if body[0] == SCHEMA:
+            self.fields = self.parse_schema(body)
+        elif body[0] == SAMPLES and self.fields is not None:
+            return self.parse_samples(body)
+        return None
+
+    @staticmethod
+    def parse_schema(body):
+        fields = []
+        at = 2
+        for _ in range(body[1]):
+            kind = body[at]
+            (scale,) = struct.unpack_from('<f', body, at + 1)
+            length = body[at + 5]
+            name = body[at + 6:at + 6 + length].decode('utf-8', 'replace')
+            fields.append((name, kind, scale))
+            at += 6 + length
+        return fields
+
+    def parse_samples(self, body):
+        time_ms, sequence = struct.unpack_from('<IH', body, 1)
+        if self.last_sequence is not None:
+            self.lost += (sequence - self.last_sequence - 1) & 0xFFFF
+        self.last_sequence = sequence
+        values = {}
+        at = 7
+        for name, kind, scale in self.fields:
+            fmt, size = TYPES[kind]
+            if at + size > len(body):
+                # the schema changed after this frame was packed
+                return None
+            (value,) = struct.unpack_from(fmt, body, at)
+            values[name] = value / scale if scale else value
+            at += size
+        return Sample(time_ms, sequence, values)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the LouUI '
+                                     'TelemetryStream into CSV')
+    parser.add_argument('source', help='serial port or captured stream')
+    parser.add_argument('--csv', help='file to write, default stdout')
+    parser.add_argument('--raw', action='store_true',
+                        help='the stream is not wrapped in PROS packets')
+    parser.add_argument('--replay', action='store_true',
+                        help='write samples at the speed they were recorded')
+    args = parser.parse_args()
+
+    decoder = Decoder()
+    out = open(args.csv, 'w') if args.csv else sys.stdout
+    header = None
+    start = None
+    with open(args.source, 'rb', buffering=0) as source:
+        for data in stdout_bytes(source, args.raw):
+            for sample in decoder.feed(data):
+                names = list(sample.values)
+                if names != header:
+                    header = names
+                    out.write(','.join(['time', 'sequence'] + names) + '\n')
+                if args.replay:
+                    if start is None:
+                        start = (time.monotonic(), sample.time)
+                    wait = start[0] + (sample.time - start[1]) / 1000 - \
+                        time.monotonic()
+                    if wait > 0:
+                        time.sleep(wait)
+                out.write(','.join([str(sample.time), str(sample.sequence)] +
+                                   ['{:g}'.format(sample.values[n])
+                                    for n in names]) + '\n')
+                out.flush()
+    if decoder.errors or decoder.lost:
+        print('telemetry: {} bad frames, {} lost samples'.format(
+            decoder.errors, decoder.lost), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()